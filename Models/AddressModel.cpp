@@ -0,0 +1,277 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+#include "AddressModel.h"
+#include "AppSetting.h"
+#include "bridgeifaces.h"
+#include "qUtils.h"
+#include <QQmlEngine>
+#include <QPointer>
+#include <QtConcurrent>
+
+AddressBalanceCache::AddressBalanceCache(QObject *parent) : QObject(parent)
+{
+
+}
+
+AddressBalanceCache::~AddressBalanceCache()
+{
+    m_balances.clear();
+    m_pending.clear();
+}
+
+void AddressBalanceCache::setWalletId(const QString &wallet_id)
+{
+    if(m_walletId != wallet_id){
+        m_walletId = wallet_id;
+        invalidate();
+    }
+}
+
+bool AddressBalanceCache::lookup(const QString &address, qint64 &amount) const
+{
+    auto it = m_balances.constFind(address);
+    if(it == m_balances.constEnd()){
+        return false;
+    }
+    amount = it.value();
+    return true;
+}
+
+void AddressBalanceCache::fetch(const QString &address, std::function<void(qint64)> done)
+{
+    qint64 amount = 0;
+    if(lookup(address, amount)){
+        if(done){
+            done(amount);
+        }
+        return;
+    }
+    bool inFlight = m_pending.contains(address);
+    if(done){
+        m_pending[address].append(done);
+    }
+    else if(!inFlight){
+        m_pending.insert(address, {});
+    }
+    if(inFlight || m_walletId.isEmpty()){
+        return;
+    }
+    QString wallet_id = m_walletId;
+    int generation = m_generation;
+    QPointer<AddressBalanceCache> guard(this);
+    QtConcurrent::run([guard, wallet_id, address, generation]() {
+        qint64 amount = bridge::nunchukGetAddressBalance(wallet_id, address);
+        if(guard){
+            QMetaObject::invokeMethod(guard.data(), [guard, address, amount, generation]() {
+                if(!guard){
+                    return;
+                }
+                QList<std::function<void(qint64)>> callbacks = guard->m_pending.take(address);
+                if(generation == guard->m_generation){
+                    guard->m_balances.insert(address, amount);
+                    emit guard->balanceReady(address, amount);
+                }
+                for(auto callback : callbacks){
+                    callback(amount);
+                }
+            }, Qt::QueuedConnection);
+        }
+    });
+}
+
+void AddressBalanceCache::invalidate()
+{
+    // In-flight results from before the invalidation are still delivered to their callers, but not cached
+    m_generation++;
+    m_balances.clear();
+}
+
+AddressListModel::AddressListModel(const QAddressBalanceCachePtr &balances) : m_balances(balances)
+{
+    QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
+    if(m_balances){
+        connect(m_balances.data(), &AddressBalanceCache::balanceReady, this, [this](const QString &address, qint64) {
+            balanceReady(address);
+        });
+    }
+}
+
+AddressListModel::~AddressListModel()
+{
+    m_addresses.clear();
+    m_matched.clear();
+    m_rowByAddress.clear();
+}
+
+int AddressListModel::rowCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent);
+    return m_loaded;
+}
+
+QVariant AddressListModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() < 0 || index.row() >= m_loaded){
+        return QVariant();
+    }
+    const QString &address = m_addresses.at(m_matched.at(index.row()));
+    if(role == address_Role){
+        return address;
+    }
+    qint64 amount = 0;
+    bool loaded = m_balances && m_balances->lookup(address, amount);
+    if(!loaded && m_balances){
+        // Only rows that a view actually asks for get their balance computed
+        m_balances->fetch(address);
+    }
+    switch (role) {
+    case address_balance_Role:
+        if((int)AppSetting::Unit::SATOSHI == AppSetting::instance()->unit()){
+            static const QLocale locale(QLocale::English);
+            return locale.toString(amount);
+        }
+        return qUtils::QValueFromAmount(amount);
+    case address_balanceSats_Role:
+        return amount;
+    case address_balanceLoaded_Role:
+        return loaded;
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> AddressListModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[address_Role]                 = "address";
+    roles[address_balance_Role]         = "address_balance";
+    roles[address_balanceSats_Role]     = "address_balanceSats";
+    roles[address_balanceLoaded_Role]   = "address_balanceLoaded";
+    return roles;
+}
+
+bool AddressListModel::canFetchMore(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent);
+    return m_loaded < m_matched.count();
+}
+
+void AddressListModel::fetchMore(const QModelIndex &parent)
+{
+    Q_UNUSED(parent);
+    int remainder = m_matched.count() - m_loaded;
+    int itemsToFetch = qMin(PAGE_SIZE, remainder);
+    if(itemsToFetch <= 0){
+        return;
+    }
+    beginInsertRows(QModelIndex(), m_loaded, m_loaded + itemsToFetch - 1);
+    m_loaded += itemsToFetch;
+    endInsertRows();
+}
+
+int AddressListModel::count() const
+{
+    return m_matched.count();
+}
+
+QString AddressListModel::filter() const
+{
+    return m_filter;
+}
+
+void AddressListModel::setFilter(const QString &filter)
+{
+    if(m_filter == filter){
+        return;
+    }
+    beginResetModel();
+    m_filter = filter;
+    applyFilter();
+    m_loaded = qMin(PAGE_SIZE, m_matched.count());
+    endResetModel();
+    emit filterChanged();
+    emit countChanged();
+}
+
+void AddressListModel::setAddresses(const QStringList &addresses)
+{
+    if(m_addresses == addresses){
+        return;
+    }
+    const int oldCount = m_addresses.count();
+    bool appended = m_filter.isEmpty() && addresses.count() > oldCount
+                    && std::equal(m_addresses.constBegin(), m_addresses.constEnd(), addresses.constBegin());
+    if(appended){
+        // New addresses only extend the tail, rows already bound stay untouched
+        m_addresses = addresses;
+        for (int i = oldCount; i < m_addresses.count(); i++) {
+            m_rowByAddress.insert(m_addresses.at(i), m_matched.count());
+            m_matched.append(i);
+        }
+        if(m_loaded == oldCount){
+            fetchMore(QModelIndex());
+        }
+    }
+    else{
+        beginResetModel();
+        m_addresses = addresses;
+        applyFilter();
+        m_loaded = qMin(qMax(m_loaded, PAGE_SIZE), m_matched.count());
+        endResetModel();
+    }
+    emit countChanged();
+}
+
+void AddressListModel::notifyUnitChanged()
+{
+    if(m_loaded > 0){
+        emit dataChanged(index(0), index(m_loaded - 1), {address_balance_Role});
+    }
+}
+
+QString AddressListModel::get(int row) const
+{
+    if(row < 0 || row >= m_matched.count()){
+        return "";
+    }
+    return m_addresses.at(m_matched.at(row));
+}
+
+void AddressListModel::applyFilter()
+{
+    m_matched.clear();
+    m_rowByAddress.clear();
+    m_matched.reserve(m_addresses.count());
+    for (int i = 0; i < m_addresses.count(); i++) {
+        const QString &address = m_addresses.at(i);
+        if(m_filter.isEmpty() || address.startsWith(m_filter, Qt::CaseInsensitive)){
+            m_rowByAddress.insert(address, m_matched.count());
+            m_matched.append(i);
+        }
+    }
+}
+
+void AddressListModel::balanceReady(const QString &address)
+{
+    int row = m_rowByAddress.value(address, -1);
+    if(row >= 0 && row < m_loaded){
+        emit dataChanged(index(row), index(row), {address_balance_Role, address_balanceSats_Role, address_balanceLoaded_Role});
+    }
+}
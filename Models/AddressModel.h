@@ -0,0 +1,104 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+
+#ifndef ADDRESSMODEL_H
+#define ADDRESSMODEL_H
+
+#include <QObject>
+#include <QAbstractListModel>
+#include <QSharedPointer>
+#include <QHash>
+#include <QSet>
+#include <functional>
+#include "QOutlog.h"
+
+// Per-wallet address balances, computed on the thread pool and kept until the wallet balance moves
+class AddressBalanceCache : public QObject
+{
+    Q_OBJECT
+public:
+    explicit AddressBalanceCache(QObject *parent = nullptr);
+    ~AddressBalanceCache();
+    void setWalletId(const QString &wallet_id);
+    bool lookup(const QString &address, qint64 &amount) const;
+    void fetch(const QString &address, std::function<void(qint64)> done = {});
+    void invalidate();
+
+signals:
+    void balanceReady(const QString &address, qint64 amount);
+
+private:
+    QString m_walletId {};
+    QHash<QString, qint64> m_balances;
+    QHash<QString, QList<std::function<void(qint64)>>> m_pending;
+    int m_generation {0};
+};
+typedef QSharedPointer<AddressBalanceCache> QAddressBalanceCachePtr;
+
+// Pages the view of a wallet's addresses: rows are exposed PAGE_SIZE at a time through
+// fetchMore() and balances are looked up only for rows that are shown. The address
+// strings themselves still arrive in one list, because libnunchuk's GetAddresses has
+// no offset or limit to fetch a window with.
+class AddressListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int      count   READ count                      NOTIFY countChanged)
+    Q_PROPERTY(QString  filter  READ filter WRITE setFilter     NOTIFY filterChanged)
+public:
+    AddressListModel(const QAddressBalanceCachePtr &balances);
+    ~AddressListModel();
+    int rowCount(const QModelIndex& parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    QHash<int,QByteArray> roleNames() const;
+    bool canFetchMore(const QModelIndex &parent) const;
+    void fetchMore(const QModelIndex &parent);
+
+    int count() const;
+    QString filter() const;
+    void setFilter(const QString &filter);
+    void setAddresses(const QStringList &addresses);
+    void notifyUnitChanged();
+    Q_INVOKABLE QString get(int row) const;
+
+    enum AddressRoles {
+        address_Role,
+        address_balance_Role,
+        address_balanceSats_Role,
+        address_balanceLoaded_Role,
+    };
+    static constexpr int PAGE_SIZE = 50;
+
+private:
+    void applyFilter();
+    void balanceReady(const QString &address);
+    QAddressBalanceCachePtr m_balances;
+    QStringList m_addresses {};
+    QVector<int> m_matched {};
+    QHash<QString, int> m_rowByAddress {};
+    QString m_filter {};
+    int m_loaded {0};
+
+signals:
+    void countChanged();
+    void filterChanged();
+};
+typedef QSharedPointer<AddressListModel> QAddressListModelPtr;
+
+#endif // ADDRESSMODEL_H
@@ -25,6 +25,8 @@
 #include "Servers/Draco.h"
 #include "localization/STR_CPP.h"
 #include <QTimer>
+#include <QPointer>
+#include <QGuiApplication>
 #include "Chats/matrixbrigde.h"
 #include "utils/enumconverter.hpp"
 #include "Premiums/QUserWallets.h"
@@ -32,6 +34,8 @@
 #include "Premiums/QWalletServicesTag.h"
 #include "ServiceSetting.h"
 #include "OnBoardingModel.h"
+#include "Commons/SignerRegistry.h"
+#include "Commons/DeviceDiscovery.h"
 
 AppModel::AppModel(): inititalized_{false},
     walletList_(QWalletListModelPtr(new WalletListModel())),
@@ -60,14 +64,56 @@ AppModel::AppModel(): inititalized_{false},
     timeLogging_(QDateTime::currentDateTime())
 {
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
-    connect(&timerRefreshHealthCheck_, &QTimer::timeout, this, &AppModel::timerHealthCheckTimeHandle, Qt::QueuedConnection);
-    connect(&timerFeeRates_, &QTimer::timeout, this, &AppModel::timerFeeRatesHandle, Qt::QueuedConnection);
-    connect(&timerCheckAuthorized_, &QTimer::timeout, this, &AppModel::timerCheckAuthorizedHandle, Qt::QueuedConnection);
+    pollScheduler_.addFeed("health_check_time", 60000, 60000, PollScheduler::Dispatch::MAIN_THREAD, [this]() {
+        timerHealthCheckTimeHandle();
+        return PollScheduler::Result::CHANGED;
+    });
+    // Thread pool rounds can outlive the model during shutdown
+    QPointer<AppModel> self(this);
+    pollScheduler_.addFeed("btc_rates", 300000, 1800000, PollScheduler::Dispatch::THREAD_POOL, [self]() {
+        if (!self) return PollScheduler::Result::FAILED;
+        double before = self->btcRates();
+        if (!Draco::instance()->btcRates()) {
+            return PollScheduler::Result::FAILED;
+        }
+        return (self && before != self->btcRates()) ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED;
+    });
+    pollScheduler_.addFeed("exchange_rates", 300000, 1800000, PollScheduler::Dispatch::THREAD_POOL, [self]() {
+        if (!self) return PollScheduler::Result::FAILED;
+        double before = self->exchangeRates();
+        if (!Draco::instance()->exchangeRates(AppSetting::instance()->currency())) {
+            return PollScheduler::Result::FAILED;
+        }
+        return (self && before != self->exchangeRates()) ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED;
+    });
+    // Fetched in the round itself, so the result reflects this round's estimate rather than the previous one
+    pollScheduler_.addFeed("estimated_fee", 300000, 1800000, PollScheduler::Dispatch::THREAD_POOL, [self]() {
+        if (!self) return PollScheduler::Result::FAILED;
+        if (!Draco::instance()->feeRates()) {
+            return PollScheduler::Result::FAILED;
+        }
+        return (self && self->updateLastFees()) ? PollScheduler::Result::CHANGED : PollScheduler::Result::UNCHANGED;
+    });
+    // Authorization drives auto sign-out, so it is never throttled
+    pollScheduler_.addFeed("check_authorized", 120000, 120000, PollScheduler::Dispatch::MAIN_THREAD, [this]() {
+        timerCheckAuthorizedHandle();
+        return PollScheduler::Result::CHANGED;
+    }, 1);
+    // Enumerates only while a device screen watches it, see DeviceDiscovery
+    pollScheduler_.addFeed(DeviceDiscovery::FEED_NAME, 5000, 300000, PollScheduler::Dispatch::THREAD_POOL, []() {
+        return DeviceDiscovery::instance()->poll();
+    });
+    connect(qApp, &QGuiApplication::applicationStateChanged, this, [this](Qt::ApplicationState state) {
+        pollScheduler_.setIdle(state != Qt::ApplicationActive);
+    });
     connect(this, &AppModel::forwardToast, this, &AppModel::recieveToast, Qt::QueuedConnection);
     connect(this, &AppModel::signViaSingature, this, &AppModel::slotSignViaSingature, Qt::QueuedConnection);
 
-    timerRefreshHealthCheck_.start(60000);  // Every 1'
-    timerFeeRates_.start(300000);           // Every 5'
+    pollScheduler_.start("health_check_time");
+    pollScheduler_.start("btc_rates");
+    pollScheduler_.start("exchange_rates");
+    pollScheduler_.start("estimated_fee");
+    pollScheduler_.start(DeviceDiscovery::FEED_NAME);
     qrExported_.clear();
     suggestMnemonics_.clear();
 
@@ -81,8 +127,7 @@ AppModel::AppModel(): inititalized_{false},
 }
 
 AppModel::~AppModel(){
-    timerRefreshHealthCheck_.stop();
-    timerCheckAuthorized_.stop();
+    pollScheduler_.stopAll();
     walletList_.clear();
     deviceList_.clear();
     masterSignerList_.clear();
@@ -236,13 +281,23 @@ void AppModel::setLasttimeCheckEstimatedFee(const QDateTime &lasttime_checkEstim
 
 void AppModel::startCheckAuthorize()
 {
-    timerCheckAuthorized_.stop();
-    timerCheckAuthorized_.start(120000); // Every 2'
+    pollScheduler_.stop("check_authorized");
+    pollScheduler_.start("check_authorized");
 }
 
 void AppModel::stopCheckAuthorize()
 {
-    timerCheckAuthorized_.stop();
+    pollScheduler_.stop("check_authorized");
+}
+
+void AppModel::registerFeedInterest(const QString &feed)
+{
+    pollScheduler_.registerInterest(feed);
+}
+
+void AppModel::unregisterFeedInterest(const QString &feed)
+{
+    pollScheduler_.unregisterInterest(feed);
 }
 
 bool AppModel::makeInstanceForAccount(const QVariant msg, const QString &dbPassphrase)
@@ -555,6 +610,15 @@ void AppModel::setMinFee(qint64 fee)
     }
 }
 
+// Records the fee estimate the last round saw and reports whether it moved since
+bool AppModel::updateLastFees()
+{
+    QString fees = QString("%1|%2|%3|%4").arg(fastestFee_).arg(halfHourFee_).arg(hourFee_).arg(minFee_);
+    bool changed = (lastFees_ != fees);
+    lastFees_ = fees;
+    return changed;
+}
+
 void AppModel::resetSignersChecked()
 {
     if(masterSignerList_){
@@ -888,6 +952,7 @@ QMasterSignerListModelPtr AppModel::masterSignerListPtr() const
 void AppModel::setMasterSignerList(const QMasterSignerListModelPtr &d)
 {
     masterSignerList_ = d;
+    SignerRegistry::instance()->invalidate();
     if(masterSignerList_){
         masterSignerList_.data()->requestSort(MasterSignerListModel::MasterSignerRoles::master_signer_name_Role, Qt::AscendingOrder);
     }
@@ -907,6 +972,7 @@ QSingleSignerListModelPtr AppModel::remoteSignerListPtr() const
 void AppModel::setRemoteSignerList(const QSingleSignerListModelPtr &d)
 {
     remoteSignerList_ = d;
+    SignerRegistry::instance()->invalidate();
     if(remoteSignerList_){
         remoteSignerList_.data()->requestSort();
     }
@@ -1013,6 +1079,10 @@ void AppModel::setWalletInfo(const QWalletPtr &d, bool force)
         if(walletInfo_){
             QString wallet_id = walletInfo_.data()->id();
             if(wallet_id != ""){
+                // Show the last known history while the live one is read and converted
+                if(walletInfo_.data()->transactionHistory() && 0 == walletInfo_.data()->transactionHistory()->count()){
+                    walletInfo_.data()->transactionHistory()->loadSnapshot(wallet_id);
+                }
                 requestSyncWalletDb(wallet_id);
                 QtConcurrent::run([wallet_id]() {
                     bridge::nunchukSetSelectedWallet(wallet_id);
@@ -1122,6 +1192,22 @@ void AppModel::setAddressBalance(const qint64 &addressBalance)
     }
 }
 
+void AppModel::requestAddressBalance(const QString &address)
+{
+    addressBalanceRequested_ = address;
+    if(walletInfo() && !address.isEmpty()){
+        qint64 amount = 0;
+        if(!walletInfo()->addressBalances()->lookup(address, amount)){
+            setAddressBalance(0);
+        }
+        walletInfo()->addressBalances()->fetch(address, [this, address](qint64 amount) {
+            if(addressBalanceRequested_ == address){
+                setAddressBalance(amount);
+            }
+        });
+    }
+}
+
 void AppModel::timerHealthCheckTimeHandle()
 {
     if(walletList()){
@@ -1135,11 +1221,7 @@ void AppModel::timerHealthCheckTimeHandle()
 
 void AppModel::timerFeeRatesHandle()
 {
-    QtConcurrent::run([this]() {
-        Draco::instance()->btcRates();
-        Draco::instance()->exchangeRates(AppSetting::instance()->currency());
-        startGetEstimatedFee();
-    });
+    pollScheduler_.trigger({"btc_rates", "exchange_rates", "estimated_fee"});
 }
 
 void AppModel::timerCheckAuthorizedHandle()
@@ -35,6 +35,7 @@
 #include "Premiums/QWalletManagement.h"
 #include "TypeDefine.h"
 #include "Commons/SignInViaDummy.h"
+#include "Commons/PollScheduler.h"
 
 class AppModel final : public Controller,
                        public SignInViaDummy
@@ -198,6 +199,7 @@ public:
     void resetSignersChecked();
     QString addressBalance() const;
     void setAddressBalance(const qint64 &addressBalance);
+    void requestAddressBalance(const QString &address);
 
     QStringList qrExported() const;
     void setQrExported(const QStringList &qrExported);
@@ -237,6 +239,8 @@ public:
 
     void startCheckAuthorize();
     void stopCheckAuthorize();
+    void registerFeedInterest(const QString &feed);
+    void unregisterFeedInterest(const QString &feed);
 
     bool makeInstanceForAccount(const QVariant msg, const QString &dbPassphrase);
     bool makeNunchukInstanceForAccount(const QVariant msg, const QString &dbPassphrase);
@@ -263,6 +267,7 @@ public:
 private:
     AppModel();
     ~AppModel();
+    bool updateLastFees();
     bool                inititalized_[2];
     QWalletListModelPtr walletList_;
     QDeviceListModelPtr deviceList_;
@@ -288,10 +293,10 @@ private:
     qint64              halfHourFee_;
     qint64              hourFee_;
     qint64              minFee_;
+    QString             lastFees_;
     qint64              addressBalance_;
-    QTimer              timerRefreshHealthCheck_;
-    QTimer              timerFeeRates_;
-    QTimer              timerCheckAuthorized_;
+    QString             addressBalanceRequested_;
+    PollScheduler       pollScheduler_;
     QStringList         qrExported_;
     QString             mnemonic_;
     QDeviceListModelPtr softwareSignerDeviceList_;
@@ -21,6 +21,7 @@
 #include "AppModel.h"
 #include "Servers/Draco.h"
 #include "QOutlog.h"
+#include <QCryptographicHash>
 
 NunchukSettings::NunchukSettings():
     QSettings(QSettings::NativeFormat, QSettings::UserScope, qApp->organizationName(), qApp->applicationName()),
@@ -131,6 +132,7 @@ AppSetting::AppSetting() :
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
     DBG_INFO << "Setting in:" << NunchukSettings::fileName();
     this->disconnect();
+    updateCachePath();
 }
 
 AppSetting::~AppSetting() {
@@ -151,6 +153,7 @@ void AppSetting::refresh()
 
 void AppSetting::setGroupSetting(QString group) {
     NunchukSettings::setGroupSetting(group);
+    updateCachePath();
     refresh();
 }
 
@@ -356,6 +359,7 @@ void AppSetting::setEnableDBEncryption(bool enableDBEncryption)
 {
     enableDBEncryption_ = enableDBEncryption;
     NunchukSettings::setValue("enableDBEncryption", enableDBEncryption_);
+    updateCachePath();
     emit enableDBEncryptionChanged();
 }
 
@@ -475,6 +479,7 @@ void AppSetting::setPrimaryServer(int primaryServer)
     if(primaryServer_ != primaryServer){
         primaryServer_ = primaryServer;
         NunchukSettings::setValueCommon("primaryServer", primaryServer_);
+        updateCachePath();
         emit primaryServerChanged();
     }
 }
@@ -580,6 +585,39 @@ QString AppSetting::storagePath()
     return storagePath_;
 }
 
+QString AppSetting::cachePath() const
+{
+    QReadLocker locker(&cacheLock_);
+    return cachePath_;
+}
+
+bool AppSetting::sensitiveCacheAllowed() const
+{
+    QReadLocker locker(&cacheLock_);
+    return sensitiveCacheAllowed_;
+}
+
+void AppSetting::updateCachePath()
+{
+    // The account name is an email; hash it so it is a safe directory name
+    QString account = groupSetting().isEmpty() ? QString("local") : QString(QCryptographicHash::hash(groupSetting().toUtf8(), QCryptographicHash::Sha256).toHex().left(16));
+    QString path = QString("%1/caches/%2/%3").arg(storagePath()).arg(account).arg(primaryServer());
+    // Never keep history, memos or card details in plain files next to a passphrase-protected database
+    bool allowed = !enableDBEncryption();
+    bool dropSensitive = false;
+    {
+        QWriteLocker locker(&cacheLock_);
+        dropSensitive = !allowed && sensitiveCacheAllowed_ && cachePath_ == path;
+        cachePath_ = path;
+        sensitiveCacheAllowed_ = allowed;
+    }
+    if (dropSensitive) {
+        QDir(path + "/snapshots").removeRecursively();
+        QDir(path + "/alerts").removeRecursively();
+        QFile::remove(path + "/tapsigners.json");
+    }
+}
+
 QString AppSetting::executePath() const
 {
     return qApp->applicationDirPath();
@@ -23,6 +23,7 @@
 
 #include <QObject>
 #include <QSettings>
+#include <QReadWriteLock>
 
 #define MAINNET_SERVER  "mainnet.nunchuk.io:51001"
 #define TESTNET_SERVER  "testnet.nunchuk.io:50001"
@@ -197,6 +198,12 @@ public:
 
     QString storagePath();
 
+    // Account and chain scoped directory for local caches, resolved on the settings
+    // thread by updateCachePath(); both getters are safe to call from any thread.
+    QString cachePath() const;
+    bool sensitiveCacheAllowed() const;
+    void updateCachePath();
+
     QString executePath() const;
     void setExecutePath(const QString &executePath);
 
@@ -284,6 +291,9 @@ private:
     QString secondaryServer_;
     bool enableFixedPrecision_;
     QString storagePath_;
+    mutable QReadWriteLock cacheLock_;
+    QString cachePath_;
+    bool sensitiveCacheAllowed_ {false};
     int connectionState_;
     int syncPercent_;
     bool enableCertificateFile_;
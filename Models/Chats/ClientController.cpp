@@ -799,8 +799,7 @@ void ClientController::DownloadFile(const QString &file_name, const QString &min
                             }
                             Conversation cons;
                             QWarningMessage evnmsg;
-                            QNunchukMatrixEvent originEvent = matrixbrigde::GetEvent(room_id, event_id, evnmsg);
-                            QJsonObject jsonEvent = matrixbrigde::stringToJson(originEvent.get_content());
+                            QJsonObject jsonEvent = matrixbrigde::GetEventContent(room_id, event_id, evnmsg);
                             room->extractNunchukEvent(matrixType,event_id,jsonEvent,cons);
                         }
                     }
@@ -20,6 +20,8 @@
 #include "QContactModel.h"
 #include "QOutlog.h"
 #include "Servers/Draco.h"
+#include <QThread>
+#include <QSet>
 
 QContactModel::QContactModel(): m_currentIndex(0)
 {
@@ -76,21 +78,102 @@ QHash<int, QByteArray> QContactModel::roleNames() const
 
 void QContactModel::syncContacts(QList<DracoUser> data)
 {
-    beginResetModel();
-    m_data.clear();
-    m_data = data;
-    endResetModel();
-    emit countChanged();
+    // Contact lists are fetched on pool threads; rows only change on the model's thread
+    if(QThread::currentThread() != thread()){
+        QMetaObject::invokeMethod(this, [this, data]() { applyContacts(data); }, Qt::QueuedConnection);
+        return;
+    }
+    applyContacts(data);
+}
+
+void QContactModel::applyContacts(const QList<DracoUser> &data)
+{
+    QStringList incomingKeys;
+    QSet<QString> keySet;
+    for (const DracoUser &user : data) {
+        QString key = keyOf(user);
+        incomingKeys.append(key);
+        keySet.insert(key);
+    }
+    const int oldCount = m_data.count();
+    QStringList keys;
+    for (int i = m_data.count() - 1; i >= 0; i--) {
+        QString key = keyOf(m_data.at(i));
+        if(!keySet.contains(key)){
+            beginRemoveRows(QModelIndex(), i, i);
+            m_data.removeAt(i);
+            endRemoveRows();
+        }
+        else {
+            keys.prepend(key);
+        }
+    }
+    for (int i = 0; i < data.count(); i++) {
+        int found = keys.indexOf(incomingKeys.at(i), i);
+        if(found < 0){
+            beginInsertRows(QModelIndex(), i, i);
+            m_data.insert(i, data.at(i));
+            keys.insert(i, incomingKeys.at(i));
+            endInsertRows();
+            continue;
+        }
+        if(found != i){
+            beginMoveRows(QModelIndex(), found, found, QModelIndex(), i);
+            m_data.move(found, i);
+            keys.move(found, i);
+            endMoveRows();
+        }
+        if(!sameUser(m_data.at(i), data.at(i))){
+            m_data[i] = data.at(i);
+            emit dataChanged(index(i), index(i));
+        }
+    }
+    // Duplicated keys leave stale rows behind the incoming list
+    if(m_data.count() > data.count()){
+        beginRemoveRows(QModelIndex(), data.count(), m_data.count() - 1);
+        while (m_data.count() > data.count()) {
+            m_data.removeLast();
+        }
+        endRemoveRows();
+    }
+    rebuildIndex();
+    if(oldCount != m_data.count()){
+        emit countChanged();
+    }
 }
 
 void QContactModel::addContact(const DracoUser user)
 {
-    beginResetModel();
+    beginInsertRows(QModelIndex(), m_data.count(), m_data.count());
     m_data.append(user);
-    endResetModel();
+    endInsertRows();
+    rebuildIndex();
     emit countChanged();
 }
 
+void QContactModel::rebuildIndex()
+{
+    m_indexByChatId.clear();
+    for (int i = 0; i < m_data.count(); i++) {
+        const DracoUser &user = m_data.at(i);
+        if(!m_indexByChatId.contains(user.chat_id.toLower())){
+            m_indexByChatId.insert(user.chat_id.toLower(), i);
+        }
+    }
+}
+
+QString QContactModel::keyOf(const DracoUser &user)
+{
+    return user.id.isEmpty() ? user.email : user.id;
+}
+
+bool QContactModel::sameUser(const DracoUser &a, const DracoUser &b)
+{
+    return a.id == b.id && a.name == b.name && a.email == b.email && a.gender == b.gender
+            && a.avatar == b.avatar && a.status == b.status && a.status_text == b.status_text
+            && a.chat_id == b.chat_id && a.username == b.username && a.login_type == b.login_type;
+}
+
 DracoUser QContactModel::getContactByIndex(const int index)
 {
     if(0 <= index && index < m_data.count() ){
@@ -105,7 +188,7 @@ QStringList QContactModel::contactsByStringList()
 {
     QStringList ret;
     ret.clear();
-    foreach (DracoUser it, m_data) {
+    for (const DracoUser &it : m_data) {
         ret << QString("%1|%2|%3|%4").arg(it.id).arg(it.name).arg(it.email).arg(it.chat_id);
     }
     return ret;
@@ -113,12 +196,8 @@ QStringList QContactModel::contactsByStringList()
 
 QString QContactModel::getContactNameByChatId(const QString &id)
 {
-    foreach (DracoUser it, m_data) {
-        if(0 == QString::compare(it.chat_id, id, Qt::CaseInsensitive)){
-            return it.name;
-        }
-    }
-    return "";
+    auto it = m_indexByChatId.constFind(id.toLower());
+    return it == m_indexByChatId.constEnd() ? QString() : m_data.at(it.value()).name;
 }
 
 void QContactModel::removeContact(const QString &contact_id)
@@ -133,6 +212,8 @@ void QContactModel::removeAll()
 {
     beginResetModel();
     m_data.clear();
+    rebuildIndex();
+    endResetModel();
     emit countChanged();
 }
 
@@ -186,12 +267,7 @@ void QContactModel::cancelFriendRequest(const QString &contact_id)
 
 bool QContactModel::containsUserId(const QString &userid)
 {
-    foreach (DracoUser it, m_data) {
-        if(0 == QString::compare(it.chat_id, userid, Qt::CaseInsensitive)){
-            return true;
-        }
-    }
-    return false;
+    return m_indexByChatId.contains(userid.toLower());
 }
 
 int QContactModel::currentIndex() const
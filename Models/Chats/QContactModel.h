@@ -65,8 +65,13 @@ public:
     int count() const;
 
 private:
+    void applyContacts(const QList<DracoUser> &data);
+    void rebuildIndex();
+    static QString keyOf(const DracoUser &user);
+    static bool sameUser(const DracoUser &a, const DracoUser &b);
     int m_currentIndex;
     QList<DracoUser> m_data;
+    QHash<QString, int> m_indexByChatId;
 
 signals:
     void currentIndexChanged();
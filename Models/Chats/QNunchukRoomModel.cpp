@@ -650,9 +650,8 @@ bool QNunchukRoom::extractNunchukEvent(const QString &matrixType, const QString
             QString init_event_id = init_event["event_id"].toString();
             QString xfp = "";
             QWarningMessage joinmsg;
-            QNunchukMatrixEvent nunJoinEvent = matrixbrigde::GetEvent(id(), join_event_id, joinmsg);
+            QJsonObject joinjson = matrixbrigde::GetEventContent(id(), join_event_id, joinmsg);
             if((int)EWARNING::WarningType::NONE_MSG == joinmsg.type()){
-                QJsonObject joinjson = matrixbrigde::stringToJson(nunJoinEvent.get_content());
                 xfp = joinjson["body"].toObject()["key"].toString().split('/')[0].remove('[');
             }
             cons.message = STR_CPP_012.arg(xfp).arg(wallet_name);
@@ -19,6 +19,7 @@
  **************************************************************************/
 #include <QQmlEngine>
 #include "QRoomTransaction.h"
+#include <QSet>
 #include "bridgeifaces.h"
 
 QRoomTransaction::QRoomTransaction()
@@ -232,6 +233,27 @@ void QRoomTransactionModel::addTransaction(const QRoomTransactionPtr &tx)
     }
 }
 
+void QRoomTransactionModel::addTransactions(const QList<QRoomTransactionPtr> &txs)
+{
+    QSet<QString> known;
+    for (const QRoomTransactionPtr &it : m_data) {
+        known.insert(it.data()->get_tx_id().toLower());
+    }
+    QList<QRoomTransactionPtr> fresh;
+    for (const QRoomTransactionPtr &tx : txs) {
+        if(tx && !known.contains(tx.data()->get_tx_id().toLower())){
+            known.insert(tx.data()->get_tx_id().toLower());
+            fresh.append(tx);
+        }
+    }
+    if(fresh.isEmpty()){
+        return;
+    }
+    beginInsertRows(QModelIndex(), m_data.count(), m_data.count() + fresh.count() - 1);
+    m_data.append(fresh);
+    endInsertRows();
+}
+
 int QRoomTransactionModel::transactionIndexById(const QString &txid)
 {
     for (int i = 0; i < m_data.count(); i++) {
@@ -291,6 +313,7 @@ QString QRoomTransactionModel::transactionInitEventById(const QString &txid)
 QSharedPointer<QRoomTransactionModel> QRoomTransactionModel::clone() const
 {
     QRoomTransactionModelPtr clone = QRoomTransactionModelPtr(new QRoomTransactionModel());
+    QList<QRoomTransactionPtr> copies;
     for (QRoomTransactionPtr tx : m_data) {
         if(tx){
             QRoomTransactionPtr ret = QRoomTransactionPtr(new QRoomTransaction(tx.data()->roomTransaction()));
@@ -302,8 +325,9 @@ QSharedPointer<QRoomTransactionModel> QRoomTransactionModel::clone() const
                 rawtx.data()->setRoomId(nunchukTx.data()->roomId());
                 ret.data()->setTransaction(rawtx);
             }
-            clone.data()->addTransaction(ret);
+            copies.append(ret);
         }
     }
+    clone.data()->addTransactions(copies);
     return clone;
 }
@@ -81,6 +81,7 @@ public:
     QHash<int, QByteArray> roleNames() const;
     void removeTransaction(const QRoomTransactionPtr &tx);
     void addTransaction(const QRoomTransactionPtr &tx);
+    void addTransactions(const QList<QRoomTransactionPtr> &txs);
     int transactionIndexById(const QString& txid);
     void transactionChanged(const QString &tx_id, const int status, const int height);
     bool contains(const QString &txid);
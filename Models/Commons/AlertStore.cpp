@@ -0,0 +1,161 @@
+#include "AlertStore.h"
+#include "AppSetting.h"
+#include "QOutlog.h"
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QFile>
+#include <QDir>
+
+AlertStore::AlertStore(const QString &key) : m_key(key)
+{
+
+}
+
+void AlertStore::setKey(const QString &key)
+{
+    if (m_key != key) {
+        m_key = key;
+        clear();
+    }
+}
+
+QString AlertStore::key() const
+{
+    return m_key;
+}
+
+QJsonArray AlertStore::alerts() const
+{
+    return m_alerts;
+}
+
+int AlertStore::count() const
+{
+    return m_alerts.size();
+}
+
+bool AlertStore::isEmpty() const
+{
+    return m_alerts.isEmpty();
+}
+
+bool AlertStore::contains(const QString &alert_id) const
+{
+    return m_indexById.contains(alert_id);
+}
+
+QString AlertStore::newestId() const
+{
+    return m_alerts.isEmpty() ? "" : m_alerts.first().toObject()["id"].toString();
+}
+
+void AlertStore::replace(const QJsonArray &alerts)
+{
+    m_alerts = alerts;
+    m_stale = false;
+    m_sinceFullWalk.start();
+    rebuildIndex();
+}
+
+void AlertStore::prepend(const QJsonArray &alerts)
+{
+    if (alerts.isEmpty()) {
+        return;
+    }
+    QJsonArray merged;
+    for (const QJsonValue &js : alerts) {
+        if (!contains(js.toObject()["id"].toString())) {
+            merged.append(js);
+        }
+    }
+    for (const QJsonValue &js : m_alerts) {
+        merged.append(js);
+    }
+    m_alerts = merged;
+    rebuildIndex();
+}
+
+bool AlertStore::remove(const QString &alert_id)
+{
+    auto it = m_indexById.find(alert_id);
+    if (it == m_indexById.end()) {
+        return false;
+    }
+    m_alerts.removeAt(it.value());
+    rebuildIndex();
+    return true;
+}
+
+void AlertStore::markStale()
+{
+    m_stale = true;
+}
+
+bool AlertStore::isStale() const
+{
+    return m_stale || !m_sinceFullWalk.isValid() || m_sinceFullWalk.hasExpired(FULL_WALK_MSECS);
+}
+
+bool AlertStore::load()
+{
+    if (!AppSetting::instance()->sensitiveCacheAllowed()) {
+        return false;
+    }
+    QFile file(filePath());
+    if (m_key.isEmpty() || !file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    file.close();
+    if (error.error != QJsonParseError::NoError || !doc.isArray()) {
+        DBG_INFO << "Alert store unreadable" << m_key << error.errorString();
+        QFile::remove(filePath());
+        return false;
+    }
+    m_alerts = doc.array();
+    // Whatever changed while the app was closed still has to be verified once
+    m_stale = true;
+    rebuildIndex();
+    return true;
+}
+
+void AlertStore::save() const
+{
+    // Group alert bodies stay in memory next to a passphrase-protected database
+    if (m_key.isEmpty() || !AppSetting::instance()->sensitiveCacheAllowed()) {
+        return;
+    }
+    QString path = filePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        DBG_INFO << "Cannot write alert store" << path;
+        return;
+    }
+    file.write(QJsonDocument(m_alerts).toJson(QJsonDocument::Compact));
+    file.commit();
+}
+
+void AlertStore::clear()
+{
+    m_alerts = QJsonArray();
+    m_indexById.clear();
+    m_stale = true;
+    m_sinceFullWalk.invalidate();
+}
+
+QString AlertStore::filePath() const
+{
+    // Syncs run on worker threads; cachePath() is already scoped to the account and chain
+    return QString("%1/alerts/%2.json").arg(AppSetting::instance()->cachePath()).arg(m_key);
+}
+
+void AlertStore::rebuildIndex()
+{
+    m_indexById.clear();
+    for (int i = 0; i < m_alerts.size(); i++) {
+        m_indexById.insert(m_alerts.at(i).toObject()["id"].toString(), i);
+    }
+}
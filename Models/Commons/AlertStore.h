@@ -0,0 +1,57 @@
+#ifndef ALERT_STORE_H
+#define ALERT_STORE_H
+#include <QString>
+#include <QStringList>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QHash>
+#include <QElapsedTimer>
+
+// Local copy of one wallet's (or group's) alert list, keyed by alert id and kept
+// in server order. Unless the database is encrypted it is persisted, so dashboards
+// can render before the network answers. It is reconciled against the server one
+// page at a time: only alerts ahead of the newest one already known are pulled.
+// A head walk cannot see edits to older alerts, so a full walk still runs after
+// loading from disk, after a local change the store can't mirror, and whenever
+// the last one is older than FULL_WALK_MSECS.
+class AlertStore
+{
+public:
+    explicit AlertStore(const QString &key = "");
+
+    void setKey(const QString &key);
+    QString key() const;
+
+    QJsonArray alerts() const;
+    int  count() const;
+    bool isEmpty() const;
+    bool contains(const QString &alert_id) const;
+    QString newestId() const;
+
+    // A full walk replaces the list; a head walk prepends alerts newer than newestId()
+    void replace(const QJsonArray &alerts);
+    void prepend(const QJsonArray &alerts);
+    bool remove(const QString &alert_id);
+    // Forces the next sync to walk the full list (e.g. after a state change the store can't mirror)
+    void markStale();
+    // True when the next sync has to be a full walk
+    bool isStale() const;
+
+    bool load();
+    void save() const;
+    void clear();
+
+    static constexpr qint64 FULL_WALK_MSECS = 10 * 60 * 1000;
+
+private:
+    QString filePath() const;
+    void    rebuildIndex();
+
+    QString             m_key;
+    QJsonArray          m_alerts;
+    QHash<QString, int> m_indexById;
+    bool                m_stale {true};
+    QElapsedTimer       m_sinceFullWalk {};
+};
+
+#endif // ALERT_STORE_H
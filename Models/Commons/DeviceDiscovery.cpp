@@ -0,0 +1,157 @@
+#include "DeviceDiscovery.h"
+#include "AppModel.h"
+#include "bridgeifaces.h"
+#include "qUtils.h"
+#include "QOutlog.h"
+
+DeviceDiscovery *DeviceDiscovery::instance()
+{
+    static DeviceDiscovery mInstance;
+    return &mInstance;
+}
+
+std::vector<nunchuk::Device> DeviceDiscovery::devices(QWarningMessage &msg)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_valid && m_signIn == signedIn() && m_type == (int)EWARNING::WarningType::NONE_MSG
+                && m_scannedAt.elapsed() < FRESH_MSECS) {
+            DBG_INFO << "cached" << m_devices.size() << m_scannedAt.elapsed();
+            return m_devices;
+        }
+    }
+    return scan(msg);
+}
+
+std::vector<nunchuk::Device> DeviceDiscovery::scan(QWarningMessage &msg)
+{
+    const bool signIn = signedIn();
+    QMutexLocker locker(&m_mutex);
+    if (m_inFlight && m_signIn == signIn) {
+        // Share the enumeration already running instead of starting another HWI process
+        const quint64 generation = m_generation;
+        while (m_generation == generation) {
+            m_done.wait(&m_mutex);
+        }
+        if (m_type != (int)EWARNING::WarningType::NONE_MSG) {
+            msg.setWarningMessage(m_code, m_what, (EWARNING::WarningType)m_type);
+        }
+        return m_devices;
+    }
+    while (m_inFlight) {
+        m_done.wait(&m_mutex);
+    }
+    m_inFlight = true;
+    m_signIn = signIn;
+    locker.unlock();
+
+    QElapsedTimer timer;
+    timer.start();
+    QWarningMessage result;
+    std::vector<nunchuk::Device> devices = enumerate(signIn, result);
+    DBG_INFO << "enumerated" << devices.size() << "in" << timer.elapsed() << "ms";
+
+    locker.relock();
+    m_devices = devices;
+    m_what = result.what();
+    m_type = result.type();
+    m_code = result.code();
+    m_valid = true;
+    m_inFlight = false;
+    m_generation++;
+    m_scannedAt.restart();
+    m_done.wakeAll();
+    locker.unlock();
+
+    if (result.type() != (int)EWARNING::WarningType::NONE_MSG) {
+        msg.setWarningMessage(result.code(), result.what(), (EWARNING::WarningType)result.type());
+    }
+    return devices;
+}
+
+void DeviceDiscovery::invalidate()
+{
+    QMutexLocker locker(&m_mutex);
+    m_valid = false;
+}
+
+PollScheduler::Result DeviceDiscovery::poll()
+{
+    if (m_watchers.loadAcquire() <= 0 || m_holds.loadAcquire() > 0) {
+        return PollScheduler::Result::UNCHANGED;
+    }
+    QString before = "";
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_valid) {
+            before = signature(m_devices);
+        }
+    }
+    QWarningMessage msg;
+    std::vector<nunchuk::Device> devices = scan(msg);
+    if (msg.type() != (int)EWARNING::WarningType::NONE_MSG) {
+        return PollScheduler::Result::FAILED;
+    }
+    if (signature(devices) == before) {
+        return PollScheduler::Result::UNCHANGED;
+    }
+    // Plugged, unplugged or unlocked: let the watching screen pick it up as if it had rescanned
+    if (m_watchers.loadAcquire() > 0) {
+        AppModel::instance()->startReportDevices(m_watchState.loadAcquire());
+    }
+    return PollScheduler::Result::CHANGED;
+}
+
+void DeviceDiscovery::watch(int state_id)
+{
+    m_watchState.storeRelease(state_id);
+    m_watchers.ref();
+    AppModel::instance()->registerFeedInterest(FEED_NAME);
+}
+
+void DeviceDiscovery::unwatch()
+{
+    if (m_watchers.loadAcquire() <= 0) {
+        return;
+    }
+    m_watchers.deref();
+    AppModel::instance()->unregisterFeedInterest(FEED_NAME);
+}
+
+DeviceDiscovery::Hold::Hold()
+{
+    DeviceDiscovery::instance()->m_holds.ref();
+}
+
+DeviceDiscovery::Hold::~Hold()
+{
+    DeviceDiscovery::instance()->m_holds.deref();
+}
+
+bool DeviceDiscovery::signedIn()
+{
+    return AppModel::instance()->isSignIn();
+}
+
+std::vector<nunchuk::Device> DeviceDiscovery::enumerate(bool signIn, QWarningMessage &msg)
+{
+    if (signIn) {
+        return qUtils::GetDevices(bridge::hwiPath(), msg);
+    }
+    return bridge::nunchukGetOriginDevices(msg);
+}
+
+QString DeviceDiscovery::signature(const std::vector<nunchuk::Device> &devices)
+{
+    QStringList keys;
+    for (const nunchuk::Device &d : devices) {
+        keys.append(QString("%1|%2|%3|%4|%5|%6").arg(QString::fromStdString(d.get_type()))
+                                                 .arg(QString::fromStdString(d.get_path()))
+                                                 .arg(QString::fromStdString(d.get_model()))
+                                                 .arg(QString::fromStdString(d.get_master_fingerprint()))
+                                                 .arg(d.needs_pin_sent())
+                                                 .arg(d.needs_pass_phrase_sent()));
+    }
+    keys.sort();
+    return keys.join(";");
+}
@@ -0,0 +1,66 @@
+#ifndef DEVICE_DISCOVERY_H
+#define DEVICE_DISCOVERY_H
+#include <QString>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QAtomicInt>
+#include <nunchuk.h>
+#include "PollScheduler.h"
+#include "QWarningMessage.h"
+
+// Owns the HWI enumeration. Each run spawns an HWI subprocess and takes seconds,
+// so the last result is kept and served to background callers while it is recent,
+// callers asking while an enumeration is running share its result, and a background
+// feed keeps the result warm while a device screen is open. Scans the user asks for
+// always enumerate again.
+class DeviceDiscovery
+{
+public:
+    static DeviceDiscovery *instance();
+
+    // Blocks only when nothing recent is cached; for background and polling callers
+    std::vector<nunchuk::Device> devices(QWarningMessage &msg);
+    // Always enumerates (or joins the enumeration already running); for user rescans
+    std::vector<nunchuk::Device> scan(QWarningMessage &msg);
+    void invalidate();
+
+    // Background feed; enumerates only while watched and no device is busy
+    PollScheduler::Result poll();
+    void watch(int state_id);
+    void unwatch();
+
+    // Held while a device is in use (signing, PIN, ...) so polling stays off the USB bus
+    class Hold
+    {
+    public:
+        Hold();
+        ~Hold();
+    };
+
+    static constexpr const char *FEED_NAME = "hwi_devices";
+    static constexpr qint64 FRESH_MSECS = 8000;
+
+private:
+    DeviceDiscovery() = default;
+    static bool signedIn();
+    static std::vector<nunchuk::Device> enumerate(bool signIn, QWarningMessage &msg);
+    static QString signature(const std::vector<nunchuk::Device> &devices);
+
+    std::vector<nunchuk::Device> m_devices;
+    QString         m_what;
+    int             m_type {0};
+    int             m_code {0};
+    bool            m_signIn {false};
+    bool            m_valid {false};
+    bool            m_inFlight {false};
+    quint64         m_generation {0};
+    QElapsedTimer   m_scannedAt;
+    QMutex          m_mutex;
+    QWaitCondition  m_done;
+    QAtomicInt      m_watchers {0};
+    QAtomicInt      m_watchState {0};
+    QAtomicInt      m_holds {0};
+};
+
+#endif // DEVICE_DISCOVERY_H
@@ -0,0 +1,82 @@
+#include "FanOut.h"
+#include <QThreadPool>
+#include <QRunnable>
+#include <QSemaphore>
+#include <QSharedPointer>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include "QOutlog.h"
+
+namespace {
+// Pulls keys off a shared index until none are left; the caller runs one lane itself
+class Lane : public QRunnable
+{
+public:
+    Lane(const QString &tag, const QStringList &keys, const FanOut::Job &job, QAtomicInt &next, QSemaphore &done)
+        : m_tag(tag), m_keys(keys), m_job(job), m_next(next), m_done(done)
+    {
+        setAutoDelete(false);
+    }
+    void run() override
+    {
+        work();
+        m_done.release();
+    }
+    void work()
+    {
+        for (int i = m_next.fetchAndAddOrdered(1); i < m_keys.size(); i = m_next.fetchAndAddOrdered(1)) {
+            const QString &key = m_keys.at(i);
+            QElapsedTimer timer;
+            timer.start();
+            m_job(key);
+            DBG_INFO << m_tag << key << timer.elapsed() << "ms";
+        }
+    }
+private:
+    const QString     &m_tag;
+    const QStringList &m_keys;
+    const FanOut::Job &m_job;
+    QAtomicInt        &m_next;
+    QSemaphore        &m_done;
+};
+}
+
+QThreadPool *FanOut::pool()
+{
+    static QThreadPool *mInstance = []() {
+        QThreadPool *pool = new QThreadPool();
+        pool->setMaxThreadCount(POOL_SIZE);
+        pool->setExpiryTimeout(POOL_EXPIRY_MSECS);
+        return pool;
+    }();
+    return mInstance;
+}
+
+bool FanOut::tryStart(QRunnable *task)
+{
+    return pool()->tryStart(task);
+}
+
+void FanOut::run(const QString &tag, const QStringList &keys, Job job, int maxConcurrency)
+{
+    if (keys.isEmpty()) {
+        return;
+    }
+    QElapsedTimer total;
+    total.start();
+    QAtomicInt next(0);
+    QSemaphore done;
+    Lane self(tag, keys, job, next, done);
+    QList<QSharedPointer<Lane>> lanes;
+    const int extra = qMin(maxConcurrency, keys.size()) - 1;
+    for (int i = 0; i < extra; i++) {
+        QSharedPointer<Lane> lane(new Lane(tag, keys, job, next, done));
+        if (!tryStart(lane.data())) {
+            break;
+        }
+        lanes.append(lane);
+    }
+    self.work();
+    done.acquire(lanes.size());
+    DBG_INFO << tag << keys.size() << "jobs on" << lanes.size() + 1 << "threads, total" << total.elapsed() << "ms";
+}
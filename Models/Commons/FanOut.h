@@ -0,0 +1,35 @@
+#ifndef FAN_OUT_H
+#define FAN_OUT_H
+#include <QString>
+#include <QStringList>
+#include <functional>
+
+class QThreadPool;
+class QRunnable;
+
+// Runs independent blocking jobs (typically one REST round trip per key) with at
+// most maxConcurrency of them in flight and returns once all of them are done.
+// Jobs merge their own results as they finish, so they must guard shared state.
+// Per-key and total latency are logged under the given tag.
+class FanOut
+{
+public:
+    typedef std::function<void(const QString &key)> Job;
+
+    static void run(const QString &tag, const QStringList &keys, Job job, int maxConcurrency = DEFAULT_CONCURRENCY);
+
+    // Long-lived pool shared with OffsetPager. Its threads outlive single calls, so the
+    // per-thread network managers in QRest keep their connections between calls.
+    static QThreadPool *pool();
+
+    // Starts task on pool() only if a thread is free right now. Callers that block on
+    // their tasks run the ones that did not start themselves, so nested fan-outs can
+    // never wait on work queued behind their own blocked threads.
+    static bool tryStart(QRunnable *task);
+
+    static constexpr int DEFAULT_CONCURRENCY = 4;
+    static constexpr int POOL_SIZE = 8;
+    static constexpr int POOL_EXPIRY_MSECS = 300000;
+};
+
+#endif // FAN_OUT_H
@@ -0,0 +1,138 @@
+#include "JsonListModel.h"
+#include <QQmlEngine>
+#include <QCoreApplication>
+#include <QThread>
+#include <QSet>
+
+JsonListModel::JsonListModel(const QStringList &keyFields, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_keyFields(keyFields)
+{
+    QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
+    // Owners are often created on pool threads, which have no event loop to deliver updates
+    if (!parent && QCoreApplication::instance() && thread() != QCoreApplication::instance()->thread()) {
+        moveToThread(QCoreApplication::instance()->thread());
+    }
+}
+
+int JsonListModel::rowCount(const QModelIndex &parent) const
+{
+    Q_UNUSED(parent);
+    return m_items.count();
+}
+
+QVariant JsonListModel::data(const QModelIndex &index, int role) const
+{
+    if (index.row() < 0 || index.row() >= m_items.count()) {
+        return QVariant();
+    }
+    switch (role) {
+    case json_modelData_Role:
+        return m_items.at(index.row()).toVariantMap();
+    case json_key_Role:
+        return m_keys.at(index.row());
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> JsonListModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[json_modelData_Role] = "modelData";
+    roles[json_key_Role]       = "key";
+    return roles;
+}
+
+int JsonListModel::count() const
+{
+    return m_items.count();
+}
+
+QJsonArray JsonListModel::items() const
+{
+    QJsonArray array;
+    for (const QJsonObject &item : m_items) {
+        array.append(item);
+    }
+    return array;
+}
+
+QVariant JsonListModel::get(int row) const
+{
+    if (row < 0 || row >= m_items.count()) {
+        return QVariant();
+    }
+    return m_items.at(row).toVariantMap();
+}
+
+void JsonListModel::setItems(const QJsonArray &items)
+{
+    // Dashboards refresh from worker threads; rows only change on the model's thread
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, [this, items]() { applyItems(items); }, Qt::QueuedConnection);
+        return;
+    }
+    applyItems(items);
+}
+
+QString JsonListModel::keyOf(const QJsonObject &item, int row) const
+{
+    for (const QString &field : m_keyFields) {
+        QString key = item.value(field).toVariant().toString();
+        if (!key.isEmpty()) {
+            return key;
+        }
+    }
+    // Items without a key are matched by position
+    return QString("#%1").arg(row);
+}
+
+void JsonListModel::applyItems(const QJsonArray &items)
+{
+    QList<QJsonObject> incoming;
+    QStringList incomingKeys;
+    QSet<QString> keySet;
+    for (int i = 0; i < items.size(); i++) {
+        QJsonObject item = items.at(i).toObject();
+        QString key = keyOf(item, i);
+        if (keySet.contains(key)) {
+            key = QString("%1#%2").arg(key).arg(i);
+        }
+        keySet.insert(key);
+        incoming.append(item);
+        incomingKeys.append(key);
+    }
+    const int oldCount = m_items.count();
+    for (int i = m_items.count() - 1; i >= 0; i--) {
+        if (!keySet.contains(m_keys.at(i))) {
+            beginRemoveRows(QModelIndex(), i, i);
+            m_items.removeAt(i);
+            m_keys.removeAt(i);
+            endRemoveRows();
+        }
+    }
+    for (int i = 0; i < incoming.count(); i++) {
+        int found = m_keys.indexOf(incomingKeys.at(i), i);
+        if (found < 0) {
+            beginInsertRows(QModelIndex(), i, i);
+            m_items.insert(i, incoming.at(i));
+            m_keys.insert(i, incomingKeys.at(i));
+            endInsertRows();
+            continue;
+        }
+        if (found != i) {
+            beginMoveRows(QModelIndex(), found, found, QModelIndex(), i);
+            m_items.move(found, i);
+            m_keys.move(found, i);
+            endMoveRows();
+        }
+        if (m_items.at(i) != incoming.at(i)) {
+            m_items[i] = incoming.at(i);
+            emit dataChanged(index(i), index(i));
+        }
+    }
+    if (oldCount != m_items.count()) {
+        emit countChanged();
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef JSON_LIST_MODEL_H
+#define JSON_LIST_MODEL_H
+#include <QAbstractListModel>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QStringList>
+#include <QSharedPointer>
+
+// List model over a JSON array of objects, for data that used to be exposed to
+// QML as a whole QVariantList. Each row is still reachable as `modelData`, so
+// existing delegates keep working. setItems() diffs the new array against the
+// current rows by key (the first non-empty of the key fields) and emits row
+// inserts, removals, moves and dataChanged instead of replacing the list.
+class JsonListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+public:
+    explicit JsonListModel(const QStringList &keyFields = {"id"}, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    int count() const;
+    QJsonArray items() const;
+    void setItems(const QJsonArray &items);
+    Q_INVOKABLE QVariant get(int row) const;
+
+    enum JsonRoles {
+        json_modelData_Role = Qt::UserRole + 1,
+        json_key_Role,
+    };
+
+signals:
+    void countChanged();
+
+private:
+    QString keyOf(const QJsonObject &item, int row) const;
+    void    applyItems(const QJsonArray &items);
+
+    QStringList        m_keyFields;
+    QList<QJsonObject> m_items;
+    QStringList        m_keys;
+};
+typedef QSharedPointer<JsonListModel> QJsonListModelPtr;
+
+#endif // JSON_LIST_MODEL_H
@@ -0,0 +1,74 @@
+#ifndef NOTIFY_BATCH_H
+#define NOTIFY_BATCH_H
+#include <QObject>
+#include <QThread>
+#include <QVector>
+#include <QAtomicInteger>
+
+// Process-wide counts, to see how much a batched refresh saves
+struct NotifyBatchStats
+{
+    static inline QAtomicInteger<quint64> emitted {0};
+    static inline QAtomicInteger<quint64> suppressed {0};
+};
+
+// Collects the NOTIFY signals an object raises while an update is open and
+// emits each one once when the outermost update closes. Signals raised from
+// another thread, or outside an update, are emitted immediately.
+template <class T>
+class NotifyBatch
+{
+public:
+    typedef void (T::*Signal)();
+
+    explicit NotifyBatch(T *owner) : m_owner(owner) {}
+
+    void begin()
+    {
+        m_depth++;
+    }
+
+    void end()
+    {
+        if (m_depth == 0 || --m_depth > 0) {
+            return;
+        }
+        QVector<Signal> pending;
+        pending.swap(m_pending);
+        for (Signal signal : pending) {
+            (m_owner->*signal)();
+        }
+        NotifyBatchStats::emitted.fetchAndAddRelaxed(pending.size());
+    }
+
+    void notify(Signal signal)
+    {
+        if (m_depth == 0 || QThread::currentThread() != m_owner->thread()) {
+            NotifyBatchStats::emitted.fetchAndAddRelaxed(1);
+            (m_owner->*signal)();
+            return;
+        }
+        if (m_pending.contains(signal)) {
+            NotifyBatchStats::suppressed.fetchAndAddRelaxed(1);
+            return;
+        }
+        m_pending.append(signal);
+    }
+
+    // Opens an update for the lifetime of the scope
+    class Scope
+    {
+    public:
+        explicit Scope(NotifyBatch &batch) : m_batch(batch) { m_batch.begin(); }
+        ~Scope() { m_batch.end(); }
+    private:
+        NotifyBatch &m_batch;
+    };
+
+private:
+    T              *m_owner {nullptr};
+    int             m_depth {0};
+    QVector<Signal> m_pending;
+};
+
+#endif // NOTIFY_BATCH_H
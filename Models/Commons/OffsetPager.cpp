@@ -0,0 +1,144 @@
+#include "OffsetPager.h"
+#include "FanOut.h"
+#include <QRunnable>
+#include <QSemaphore>
+#include <QSharedPointer>
+#include <QElapsedTimer>
+#include <QQueue>
+#include "QOutlog.h"
+
+namespace {
+// One page request; started on the shared pool when a thread is free, otherwise
+// fetched by the consumer itself once the page is due
+class PageTask : public QRunnable
+{
+public:
+    PageTask(const OffsetPager::FetchPage &fetch, int offset, int limit)
+        : offset(offset), limit(limit), m_fetch(fetch)
+    {
+        setAutoDelete(false);
+    }
+    void run() override
+    {
+        ok = m_fetch(offset, limit, items);
+        m_done.release();
+    }
+    void wait()
+    {
+        if (started) {
+            m_done.acquire();
+            m_done.release();
+        }
+        else {
+            run();
+        }
+    }
+    const int  offset;
+    const int  limit;
+    bool       started {false};
+    bool       ok {false};
+    QJsonArray items {};
+private:
+    OffsetPager::FetchPage m_fetch;
+    QSemaphore             m_done;
+};
+typedef QSharedPointer<PageTask> InFlight;
+}
+
+OffsetPager::OffsetPager(const QString &tag, FetchPage fetch, int pageSize, int maxPageSize, int prefetch)
+    : m_tag(tag)
+    , m_fetch(fetch)
+    , m_pageSize(qMax(1, pageSize))
+    , m_maxPageSize(qMax(m_pageSize, maxPageSize))
+    , m_prefetch(qMax(0, prefetch))
+{
+
+}
+
+bool OffsetPager::run(ConsumePage consume, Cursor *cursor)
+{
+    if (cursor && cursor->finished) {
+        return true;
+    }
+    QElapsedTimer total;
+    total.start();
+    int offset = cursor ? cursor->offset : 0;
+    int pageSize = (cursor && cursor->pageSize > 0) ? cursor->pageSize : m_pageSize;
+    int maxPageSize = m_maxPageSize;
+    // The largest page size the server is known to serve in full
+    int servedSize = m_pageSize;
+    int pages = 0;
+    bool ok = true;
+    bool finished = false;
+
+    QQueue<InFlight> queue;
+    // Every page handed to the pool, including ones dropped on a replan, is waited
+    // for before returning since the tasks are owned here
+    QList<InFlight> started;
+    int nextOffset = offset;
+    int nextSize = pageSize;
+    auto request = [&]() {
+        InFlight page(new PageTask(m_fetch, nextOffset, nextSize));
+        // The page due next is fetched inline; only the prefetched ones go to the pool
+        if (!queue.isEmpty() && FanOut::tryStart(page.data())) {
+            page->started = true;
+            started.append(page);
+        }
+        queue.enqueue(page);
+        // Assume a full page when planning ahead; mismatches are dropped below
+        nextOffset += nextSize;
+        nextSize = qMin(nextSize * 2, maxPageSize);
+    };
+
+    request();
+    while (!queue.isEmpty()) {
+        while (queue.size() <= m_prefetch) {
+            request();
+        }
+        InFlight page = queue.dequeue();
+        page->wait();
+        pages++;
+        if (!page->ok) {
+            ok = false;
+            break;
+        }
+        const int count = page->items.size();
+        offset = page->offset + count;
+        if (count >= page->limit) {
+            servedSize = qMax(servedSize, page->limit);
+            pageSize = nextSize;
+        }
+        else if (count < servedSize || count == 0) {
+            finished = true;
+        }
+        else {
+            // The server capped the page; continue with what it actually serves
+            maxPageSize = count;
+            pageSize = count;
+        }
+        if (count > 0 && !consume(page->items)) {
+            break;
+        }
+        if (finished) {
+            break;
+        }
+        if (count < page->limit || (!queue.isEmpty() && queue.head()->offset != offset)) {
+            // Planned pages no longer line up with the data; replan from here
+            queue.clear();
+            nextOffset = offset;
+            nextSize = pageSize;
+            request();
+        }
+    }
+    queue.clear();
+    for (const InFlight &page : started) {
+        page->wait();
+    }
+    if (cursor) {
+        cursor->offset = offset;
+        cursor->pageSize = pageSize;
+        cursor->finished = finished;
+    }
+    DBG_INFO << m_tag << pages << "pages up to offset" << offset << "in" << total.elapsed() << "ms" << (ok ? "" : "(failed)");
+    return ok;
+}
@@ -0,0 +1,48 @@
+#ifndef OFFSET_PAGER_H
+#define OFFSET_PAGER_H
+#include <QString>
+#include <QJsonArray>
+#include <functional>
+
+// Walks an offset/limit endpoint page by page.
+// - Pages grow from pageSize up to maxPageSize while the server keeps returning
+//   full pages, and shrink to whatever the server actually serves if it caps them.
+// - Up to `prefetch` following pages are requested while the current one is
+//   consumed; pages are still handed to the consumer strictly in order.
+// - The consumer stops the walk early by returning false.
+// - A Cursor records where the walk stopped so a later call can resume there.
+class OffsetPager
+{
+public:
+    struct Cursor {
+        int  offset {0};
+        int  pageSize {0};
+        bool finished {false};
+    };
+    // Fetches items [offset, offset + limit); returns false when the request failed
+    typedef std::function<bool(int offset, int limit, QJsonArray &items)> FetchPage;
+    // Receives each page in order; returns false to stop paging
+    typedef std::function<bool(const QJsonArray &items)> ConsumePage;
+
+    OffsetPager(const QString &tag,
+                FetchPage fetch,
+                int pageSize = DEFAULT_PAGE_SIZE,
+                int maxPageSize = DEFAULT_MAX_PAGE_SIZE,
+                int prefetch = DEFAULT_PREFETCH);
+
+    // Returns false if a page could not be fetched; pages consumed before that stay consumed
+    bool run(ConsumePage consume, Cursor *cursor = nullptr);
+
+    static constexpr int DEFAULT_PAGE_SIZE = 10;
+    static constexpr int DEFAULT_MAX_PAGE_SIZE = 50;
+    static constexpr int DEFAULT_PREFETCH = 2;
+
+private:
+    QString   m_tag;
+    FetchPage m_fetch;
+    int       m_pageSize;
+    int       m_maxPageSize;
+    int       m_prefetch;
+};
+
+#endif // OFFSET_PAGER_H
@@ -0,0 +1,230 @@
+#include "PollScheduler.h"
+#include <QtConcurrent>
+#include <climits>
+#include <QThread>
+#include "QOutlog.h"
+
+PollScheduler::PollScheduler(QObject *parent) : QObject(parent)
+{
+
+}
+
+PollScheduler::~PollScheduler()
+{
+    stopAll();
+}
+
+void PollScheduler::addFeed(const QString &name, int interval, int maxInterval, Dispatch dispatch, Fetcher fetcher, int idleFactor)
+{
+    if (m_feeds.contains(name)) {
+        return;
+    }
+    Feed feed;
+    feed.fetcher = fetcher;
+    feed.dispatch = dispatch;
+    feed.interval = interval;
+    feed.maxInterval = qMax(interval, maxInterval);
+    feed.idleFactor = qMax(1, idleFactor);
+    feed.timer = new QTimer(this);
+    feed.timer->setSingleShot(true);
+    connect(feed.timer, &QTimer::timeout, this, [this, name]() {
+        fire(name);
+    });
+    m_feeds.insert(name, feed);
+}
+
+void PollScheduler::start(const QString &name)
+{
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, [this, name]() { start(name); }, Qt::QueuedConnection);
+        return;
+    }
+    auto it = m_feeds.find(name);
+    if (it == m_feeds.end() || it->running) {
+        return;
+    }
+    it->running = true;
+    it->backoff = 0;
+    schedule(name);
+}
+
+void PollScheduler::stop(const QString &name)
+{
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, [this, name]() { stop(name); }, Qt::QueuedConnection);
+        return;
+    }
+    auto it = m_feeds.find(name);
+    if (it == m_feeds.end()) {
+        return;
+    }
+    it->running = false;
+    it->pending = false;
+    it->timer->stop();
+}
+
+void PollScheduler::stopAll()
+{
+    for (const QString &name : m_feeds.keys()) {
+        stop(name);
+    }
+}
+
+void PollScheduler::trigger(const QStringList &names)
+{
+    if (QThread::currentThread() != thread()) {
+        QMetaObject::invokeMethod(this, [this, names]() { trigger(names); }, Qt::QueuedConnection);
+        return;
+    }
+    // Independent feeds are dispatched back to back so their fetches overlap
+    for (const QString &name : names) {
+        auto it = m_feeds.find(name);
+        if (it == m_feeds.end()) {
+            continue;
+        }
+        it->backoff = 0;
+        fire(name);
+    }
+}
+
+void PollScheduler::registerInterest(const QString &name)
+{
+    auto it = m_feeds.find(name);
+    if (it == m_feeds.end()) {
+        return;
+    }
+    it->interest++;
+    if (it->interest == 1 && it->running) {
+        it->backoff = 0;
+        if (!it->lastRun.isValid() || it->lastRun.elapsed() >= it->interval) {
+            fire(name);
+        }
+        else {
+            schedule(name);
+        }
+    }
+}
+
+void PollScheduler::unregisterInterest(const QString &name)
+{
+    auto it = m_feeds.find(name);
+    if (it == m_feeds.end() || it->interest == 0) {
+        return;
+    }
+    it->interest--;
+}
+
+bool PollScheduler::idle() const
+{
+    return m_idle;
+}
+
+void PollScheduler::setIdle(bool idle)
+{
+    if (m_idle == idle) {
+        return;
+    }
+    m_idle = idle;
+    DBG_INFO << "idle:" << idle;
+    if (idle) {
+        // Stretch the timers already armed at the active interval
+        for (const QString &name : m_feeds.keys()) {
+            const Feed &feed = m_feeds[name];
+            if (feed.running && !feed.inFlight && feed.timer->isActive()) {
+                schedule(name);
+            }
+        }
+        return;
+    }
+    // Catch up feeds that became stale while throttled
+    for (const QString &name : m_feeds.keys()) {
+        const Feed &feed = m_feeds[name];
+        if (!feed.running || feed.inFlight) {
+            continue;
+        }
+        if (!feed.lastRun.isValid() || feed.lastRun.elapsed() >= nextInterval(feed)) {
+            fire(name);
+        }
+        else {
+            schedule(name);
+        }
+    }
+}
+
+int PollScheduler::nextInterval(const Feed &feed) const
+{
+    if (feed.interest > 0) {
+        return feed.interval;
+    }
+    qint64 interval = qMin(static_cast<qint64>(feed.interval) << feed.backoff, static_cast<qint64>(feed.maxInterval));
+    if (m_idle) {
+        interval *= feed.idleFactor;
+    }
+    return static_cast<int>(qMin<qint64>(interval, INT_MAX));
+}
+
+void PollScheduler::schedule(const QString &name)
+{
+    auto it = m_feeds.find(name);
+    if (it == m_feeds.end() || !it->running) {
+        return;
+    }
+    int interval = nextInterval(*it);
+    if (it->lastRun.isValid()) {
+        interval = static_cast<int>(qMax<qint64>(0, interval - it->lastRun.elapsed()));
+    }
+    it->timer->start(interval);
+}
+
+void PollScheduler::fire(const QString &name)
+{
+    auto it = m_feeds.find(name);
+    if (it == m_feeds.end()) {
+        return;
+    }
+    if (it->inFlight) {
+        // Coalesce with the request already on the wire
+        it->pending = true;
+        return;
+    }
+    it->timer->stop();
+    it->inFlight = true;
+    it->pending = false;
+    it->lastRun.restart();
+    Fetcher fetcher = it->fetcher;
+    if (it->dispatch == Dispatch::MAIN_THREAD) {
+        finished(name, fetcher());
+    }
+    else {
+        QtConcurrent::run([this, name, fetcher]() {
+            Result result = fetcher();
+            QMetaObject::invokeMethod(this, [this, name, result]() {
+                finished(name, result);
+            }, Qt::QueuedConnection);
+        });
+    }
+}
+
+void PollScheduler::finished(const QString &name, Result result)
+{
+    auto it = m_feeds.find(name);
+    if (it == m_feeds.end()) {
+        return;
+    }
+    it->inFlight = false;
+    switch (result) {
+    case Result::CHANGED:
+        it->backoff = 0;
+        break;
+    case Result::UNCHANGED:
+    case Result::FAILED:
+        it->backoff = qMin(it->backoff + 1, static_cast<int>(MAX_BACKOFF));
+        break;
+    }
+    if (it->pending) {
+        it->pending = false;
+        fire(name);
+        return;
+    }
+    schedule(name);
+}
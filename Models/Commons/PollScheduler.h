@@ -0,0 +1,69 @@
+#ifndef POLL_SCHEDULER_H
+#define POLL_SCHEDULER_H
+#include <QObject>
+#include <QTimer>
+#include <QHash>
+#include <QElapsedTimer>
+#include <functional>
+
+// Drives the periodic data feeds (rates, fees, authorization, ...) from one place.
+// Each feed backs off exponentially while its results are unchanged or failing,
+// slows down while the application is not active, and returns to its base
+// interval while at least one screen has registered interest in it.
+class PollScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    enum class Result {
+        CHANGED,
+        UNCHANGED,
+        FAILED,
+    };
+    enum class Dispatch {
+        MAIN_THREAD,
+        THREAD_POOL,
+    };
+    typedef std::function<Result()> Fetcher;
+
+    explicit PollScheduler(QObject *parent = nullptr);
+    ~PollScheduler();
+
+    void addFeed(const QString &name, int interval, int maxInterval, Dispatch dispatch, Fetcher fetcher, int idleFactor = DEFAULT_IDLE_FACTOR);
+    void start(const QString &name);
+    void stop(const QString &name);
+    void stopAll();
+    void trigger(const QStringList &names);
+    void registerInterest(const QString &name);
+    void unregisterInterest(const QString &name);
+
+    bool idle() const;
+    void setIdle(bool idle);
+
+    static constexpr int DEFAULT_IDLE_FACTOR = 4;
+    static constexpr int MAX_BACKOFF = 6;
+
+private:
+    struct Feed {
+        Fetcher         fetcher;
+        Dispatch        dispatch {Dispatch::THREAD_POOL};
+        int             interval {0};
+        int             maxInterval {0};
+        int             idleFactor {DEFAULT_IDLE_FACTOR};
+        int             backoff {0};
+        int             interest {0};
+        bool            running {false};
+        bool            inFlight {false};
+        bool            pending {false};
+        QElapsedTimer   lastRun;
+        QTimer*         timer {nullptr};
+    };
+    int  nextInterval(const Feed &feed) const;
+    void schedule(const QString &name);
+    void fire(const QString &name);
+    void finished(const QString &name, Result result);
+
+    QHash<QString, Feed> m_feeds;
+    bool m_idle {false};
+};
+
+#endif // POLL_SCHEDULER_H
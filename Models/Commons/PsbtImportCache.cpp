@@ -0,0 +1,121 @@
+#include "PsbtImportCache.h"
+#include "AppSetting.h"
+#include "QOutlog.h"
+#include <QCryptographicHash>
+#include <QJsonDocument>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QFile>
+#include <QDir>
+#include <QSet>
+
+PsbtImportCache::PsbtImportCache(const QString &wallet_id) : m_walletId(wallet_id)
+{
+
+}
+
+QString PsbtImportCache::digest(const QJsonObject &transaction)
+{
+    // Memo, type and schedule are applied right after the import, so a change to any of them must re-run it
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(transaction.value("psbt").toString().toUtf8());
+    hash.addData("\n");
+    hash.addData(transaction.value("note").toString().toUtf8());
+    hash.addData("\n");
+    hash.addData(transaction.value("type").toString().toUtf8());
+    hash.addData("\n");
+    hash.addData(QByteArray::number(static_cast<qint64>(transaction.value("broadcast_time_milis").toDouble())));
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+bool PsbtImportCache::unchanged(const QString &tx_id, const QString &digest) const
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = m_digests.constFind(tx_id);
+    return it != m_digests.constEnd() && it.value() == digest;
+}
+
+void PsbtImportCache::record(const QString &tx_id, const QString &digest)
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_digests.value(tx_id) != digest) {
+        m_digests.insert(tx_id, digest);
+        m_dirty = true;
+    }
+}
+
+void PsbtImportCache::retain(const QStringList &tx_ids)
+{
+    QMutexLocker locker(&m_mutex);
+    QSet<QString> keep;
+    for (const QString &tx_id : tx_ids) {
+        keep.insert(tx_id);
+    }
+    for (auto it = m_digests.begin(); it != m_digests.end();) {
+        if (keep.contains(it.key())) {
+            ++it;
+        }
+        else {
+            it = m_digests.erase(it);
+            m_dirty = true;
+        }
+    }
+}
+
+bool PsbtImportCache::load()
+{
+    QFile file(filePath(m_walletId));
+    if (m_walletId.isEmpty() || !file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    file.close();
+    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+        DBG_INFO << "PSBT cache unreadable" << m_walletId << error.errorString();
+        remove(m_walletId);
+        return false;
+    }
+    QMutexLocker locker(&m_mutex);
+    m_digests.clear();
+    QJsonObject digests = doc.object();
+    for (auto it = digests.constBegin(); it != digests.constEnd(); ++it) {
+        m_digests.insert(it.key(), it.value().toString());
+    }
+    m_dirty = false;
+    return true;
+}
+
+void PsbtImportCache::save()
+{
+    QMutexLocker locker(&m_mutex);
+    if (m_walletId.isEmpty() || !m_dirty) {
+        return;
+    }
+    QJsonObject digests;
+    for (auto it = m_digests.constBegin(); it != m_digests.constEnd(); ++it) {
+        digests.insert(it.key(), it.value());
+    }
+    QString path = filePath(m_walletId);
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        DBG_INFO << "Cannot write PSBT cache" << path;
+        return;
+    }
+    file.write(QJsonDocument(digests).toJson(QJsonDocument::Compact));
+    if (file.commit()) {
+        m_dirty = false;
+    }
+}
+
+void PsbtImportCache::remove(const QString &wallet_id)
+{
+    QFile::remove(filePath(wallet_id));
+}
+
+QString PsbtImportCache::filePath(const QString &wallet_id)
+{
+    // Imports run on worker threads; cachePath() is already scoped to the account and chain
+    return QString("%1/psbts/%2.json").arg(AppSetting::instance()->cachePath()).arg(wallet_id);
+}
@@ -0,0 +1,37 @@
+#ifndef PSBT_IMPORT_CACHE_H
+#define PSBT_IMPORT_CACHE_H
+#include <QString>
+#include <QStringList>
+#include <QJsonObject>
+#include <QHash>
+#include <QMutex>
+
+// Remembers, per wallet, a digest of every server transaction (PSBT plus the
+// fields applied alongside it) that was last imported successfully, so a sync
+// only hands libnunchuk the transactions that actually changed. Entries for
+// transactions the server no longer returns are dropped on save().
+class PsbtImportCache
+{
+public:
+    explicit PsbtImportCache(const QString &wallet_id);
+
+    static QString digest(const QJsonObject &transaction);
+
+    bool unchanged(const QString &tx_id, const QString &digest) const;
+    void record(const QString &tx_id, const QString &digest);
+    void retain(const QStringList &tx_ids);
+
+    bool load();
+    void save();
+    static void remove(const QString &wallet_id);
+
+private:
+    static QString filePath(const QString &wallet_id);
+
+    QString                 m_walletId;
+    QHash<QString, QString> m_digests;
+    mutable QMutex          m_mutex;
+    bool                    m_dirty {false};
+};
+
+#endif // PSBT_IMPORT_CACHE_H
@@ -9,6 +9,7 @@
 #include "WalletModel.h"
 #include "AppSetting.h"
 #include "AppModel.h"
+#include "DeviceDiscovery.h"
 
 bool SignInViaDummy::SignInUsingXPUBorWallet(const QString &bsms)
 {
@@ -160,10 +161,19 @@ bool SignInViaDummy::SignInRequestSignTx(const QString &xfp)
     nunchuk::SingleSigner signer = *std::find_if(m_wallet.get_signers().begin(), m_wallet.get_signers().end(), [xfp](const nunchuk::SingleSigner &s) {
         return s.get_master_fingerprint() == xfp.toStdString();
     });
-    std::vector<nunchuk::Device> devices = qUtils::GetDevices(bridge::hwiPath(), warningmsg);
-    auto it = std::find_if(devices.begin(), devices.end(), [xfp](const nunchuk::Device &d) {
-        return d.get_master_fingerprint() == xfp.toStdString();
-    });
+    std::vector<nunchuk::Device> devices = DeviceDiscovery::instance()->devices(warningmsg);
+    auto findDevice = [&devices, xfp]() {
+        return std::find_if(devices.begin(), devices.end(), [xfp](const nunchuk::Device &d) {
+            return d.get_master_fingerprint() == xfp.toStdString();
+        });
+    };
+    auto it = findDevice();
+    if (it == devices.end()) {
+        // The card may have been plugged in after the cached enumeration
+        warningmsg.resetWarningMessage();
+        devices = DeviceDiscovery::instance()->scan(warningmsg);
+        it = findDevice();
+    }
     nunchuk::Device device;
     if (it != devices.end()) {
         device = *it;
@@ -0,0 +1,77 @@
+#include "SignerRegistry.h"
+#include "bridgeifaces.h"
+#include "nunchuckiface.h"
+#include "AppSetting.h"
+#include "QOutlog.h"
+
+SignerRegistry *SignerRegistry::instance()
+{
+    static SignerRegistry mInstance;
+    return &mInstance;
+}
+
+QString SignerRegistry::normalize(const QString &xfp)
+{
+    return xfp.trimmed().toLower();
+}
+
+bool SignerRegistry::isMasterSigner(const QString &xfp)
+{
+    QMutexLocker locker(&m_mutex);
+    ensureLoaded();
+    return m_masters.contains(normalize(xfp));
+}
+
+bool SignerRegistry::isRemoteSigner(const QString &xfp)
+{
+    QMutexLocker locker(&m_mutex);
+    ensureLoaded();
+    return m_remotes.contains(normalize(xfp));
+}
+
+bool SignerRegistry::isLocal(const QString &xfp)
+{
+    const QString key = normalize(xfp);
+    QMutexLocker locker(&m_mutex);
+    ensureLoaded();
+    return m_masters.contains(key) || m_remotes.contains(key);
+}
+
+void SignerRegistry::invalidate()
+{
+    QMutexLocker locker(&m_mutex);
+    m_loaded = false;
+}
+
+QString SignerRegistry::instanceKey()
+{
+    // cachePath() is already scoped to the account and chain, and safe off the GUI thread
+    return QString("%1:%2").arg(nunchukiface::instance()->nunchukMode()).arg(AppSetting::instance()->cachePath());
+}
+
+void SignerRegistry::ensureLoaded()
+{
+    const QString key = instanceKey();
+    if (m_loaded && m_loadedKey == key) {
+        return;
+    }
+    m_loadedKey = key;
+    m_masters.clear();
+    m_remotes.clear();
+    QWarningMessage msgMaster;
+    for (const nunchuk::MasterSigner &signer : bridge::nunchukGetOriginMasterSigners(msgMaster)) {
+        // Older master signers are looked up by id as well as by device fingerprint
+        m_masters.insert(normalize(QString::fromStdString(signer.get_device().get_master_fingerprint())));
+        m_masters.insert(normalize(QString::fromStdString(signer.get_id())));
+    }
+    QWarningMessage msgRemote;
+    for (const nunchuk::SingleSigner &signer : bridge::nunchukGetOriginRemoteSigners(msgRemote)) {
+        m_remotes.insert(normalize(QString::fromStdString(signer.get_master_fingerprint())));
+    }
+    m_masters.remove(QString());
+    m_remotes.remove(QString());
+    // A failed listing is retried on the next question instead of caching an empty answer
+    m_loaded = (int)EWARNING::WarningType::NONE_MSG == msgMaster.type()
+            && (int)EWARNING::WarningType::NONE_MSG == msgRemote.type();
+    DBG_INFO << "masters:" << m_masters.count() << "remotes:" << m_remotes.count();
+}
@@ -0,0 +1,35 @@
+#ifndef SIGNER_REGISTRY_H
+#define SIGNER_REGISTRY_H
+#include <QString>
+#include <QSet>
+#include <QMutex>
+
+// Fingerprints of the master and remote signers stored on this device, read from
+// libnunchuk once and kept until a signer or wallet is created, imported or deleted.
+// The lists belong to one libnunchuk instance, so they are read again whenever the
+// mode (local or online) or the signed-in account changes.
+// Answers isMine/isLocal style questions without listing every signer again.
+class SignerRegistry
+{
+public:
+    static SignerRegistry *instance();
+    static QString normalize(const QString &xfp);
+
+    bool isMasterSigner(const QString &xfp);
+    bool isRemoteSigner(const QString &xfp);
+    bool isLocal(const QString &xfp);
+    void invalidate();
+
+private:
+    SignerRegistry() = default;
+    void ensureLoaded();
+    static QString instanceKey();
+
+    QSet<QString>   m_masters;
+    QSet<QString>   m_remotes;
+    bool            m_loaded {false};
+    QString         m_loadedKey;
+    QMutex          m_mutex;
+};
+
+#endif // SIGNER_REGISTRY_H
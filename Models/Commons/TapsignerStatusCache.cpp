@@ -0,0 +1,200 @@
+#include "TapsignerStatusCache.h"
+#include "AppModel.h"
+#include "AppSetting.h"
+#include "nunchuckiface.h"
+#include "QOutlog.h"
+#include <QtConcurrent>
+#include <QCoreApplication>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDateTime>
+#include <QSaveFile>
+#include <QFileInfo>
+#include <QFile>
+#include <QDir>
+
+TapsignerStatusCache *TapsignerStatusCache::instance()
+{
+    static TapsignerStatusCache mInstance;
+    return &mInstance;
+}
+
+bool TapsignerStatusCache::status(const QString &xfp, Status &out)
+{
+    const QString key = xfp.toLower();
+    bool found = false;
+    bool stale = true;
+    {
+        QMutexLocker locker(&m_mutex);
+        ensureLoaded();
+        auto it = m_entries.constFind(key);
+        if (it != m_entries.constEnd()) {
+            out = it.value();
+            found = true;
+            stale = QDateTime::currentSecsSinceEpoch() - out.updatedAt > STALE_AFTER_SECS;
+        }
+        if (m_unknown.contains(key)) {
+            stale = false;
+        }
+    }
+    if (stale) {
+        refresh(key);
+    }
+    return found;
+}
+
+void TapsignerStatusCache::update(const QString &xfp, const nunchuk::TapsignerStatus &status)
+{
+    const QString key = xfp.toLower();
+    QMutexLocker locker(&m_mutex);
+    ensureLoaded();
+    m_entries.insert(key, convert(status));
+    m_unknown.remove(key);
+    save();
+}
+
+void TapsignerStatusCache::remove(const QString &xfp)
+{
+    const QString key = xfp.toLower();
+    QMutexLocker locker(&m_mutex);
+    ensureLoaded();
+    m_unknown.remove(key);
+    if (m_entries.remove(key) > 0) {
+        save();
+    }
+}
+
+void TapsignerStatusCache::refresh(const QString &xfp)
+{
+    QString path;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_inFlight.contains(xfp)) {
+            return;
+        }
+        m_inFlight.insert(xfp);
+        path = m_loadedPath;
+    }
+    QtConcurrent::run([this, xfp, path]() {
+        QWarningMessage msg;
+        nunchuk::TapsignerStatus tapsigner = nunchukiface::instance()->GetTapsignerStatusFromMasterSigner(xfp.toStdString(), msg);
+        const bool ok = (int)EWARNING::WarningType::NONE_MSG == msg.type();
+        QString card_id;
+        {
+            QMutexLocker locker(&m_mutex);
+            m_inFlight.remove(xfp);
+            ensureLoaded();
+            if (m_loadedPath != path) {
+                // The account changed while the card was asked; the answer belongs to the old one
+                return;
+            }
+            if (ok) {
+                Status entry = convert(tapsigner);
+                card_id = entry.cardIdent;
+                m_entries.insert(xfp, entry);
+                m_unknown.remove(xfp);
+                save();
+            }
+            else {
+                // Failed or not a TAPSIGNER; keep what we have and do not ask again this session
+                m_unknown.insert(xfp);
+            }
+        }
+        if (!ok) {
+            return;
+        }
+        QMetaObject::invokeMethod(qApp, [xfp, card_id]() {
+            if (AppModel::instance()->masterSignerList()) {
+                QMasterSignerPtr signer = AppModel::instance()->masterSignerList()->getMasterSignerByXfp(xfp);
+                if (signer) {
+                    signer.data()->device()->setCardId(card_id);
+                }
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+void TapsignerStatusCache::ensureLoaded()
+{
+    const QString path = filePath();
+    const bool persist = AppSetting::instance()->sensitiveCacheAllowed();
+    if (path == m_loadedPath && persist == m_persist) {
+        return;
+    }
+    // Switched account or server: start over from that account's file
+    m_loadedPath = path;
+    m_persist = persist;
+    m_entries.clear();
+    m_unknown.clear();
+    if (!persist) {
+        return;
+    }
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    file.close();
+    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+        DBG_INFO << "TAPSIGNER cache unreadable" << error.errorString();
+        QFile::remove(path);
+        return;
+    }
+    QJsonObject entries = doc.object();
+    for (auto it = entries.constBegin(); it != entries.constEnd(); ++it) {
+        QJsonObject js = it.value().toObject();
+        Status entry;
+        entry.cardIdent = js["card_ident"].toString();
+        entry.version = js["version"].toString();
+        entry.birthHeight = js["birth_height"].toInt();
+        entry.backups = js["backups"].toInt();
+        entry.isTestnet = js["is_testnet"].toBool();
+        entry.updatedAt = static_cast<qint64>(js["updated_at"].toDouble());
+        m_entries.insert(it.key(), entry);
+    }
+}
+
+void TapsignerStatusCache::save()
+{
+    if (!m_persist) {
+        return;
+    }
+    QJsonObject entries;
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        QJsonObject js;
+        js["card_ident"] = it.value().cardIdent;
+        js["version"] = it.value().version;
+        js["birth_height"] = it.value().birthHeight;
+        js["backups"] = it.value().backups;
+        js["is_testnet"] = it.value().isTestnet;
+        js["updated_at"] = static_cast<double>(it.value().updatedAt);
+        entries.insert(it.key(), js);
+    }
+    QDir().mkpath(QFileInfo(m_loadedPath).absolutePath());
+    QSaveFile file(m_loadedPath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        DBG_INFO << "Cannot write TAPSIGNER cache" << m_loadedPath;
+        return;
+    }
+    file.write(QJsonDocument(entries).toJson(QJsonDocument::Compact));
+    file.commit();
+}
+
+TapsignerStatusCache::Status TapsignerStatusCache::convert(const nunchuk::TapsignerStatus &status)
+{
+    Status entry;
+    entry.cardIdent = QString::fromStdString(status.get_card_ident());
+    entry.version = QString::fromStdString(status.get_version());
+    entry.birthHeight = status.get_birth_height();
+    entry.backups = status.get_number_of_backup();
+    entry.isTestnet = status.is_testnet();
+    entry.updatedAt = QDateTime::currentSecsSinceEpoch();
+    return entry;
+}
+
+QString TapsignerStatusCache::filePath()
+{
+    // Looked up from the thread pool too; cachePath() is already scoped to the account and chain
+    return QString("%1/tapsigners.json").arg(AppSetting::instance()->cachePath());
+}
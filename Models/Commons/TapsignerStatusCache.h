@@ -0,0 +1,50 @@
+#ifndef TAPSIGNER_STATUS_CACHE_H
+#define TAPSIGNER_STATUS_CACHE_H
+#include <QString>
+#include <QHash>
+#include <QSet>
+#include <QMutex>
+#include <nunchuk.h>
+
+// Last known status of every TAPSIGNER on this account, keyed by master
+// fingerprint and kept in the account's cache directory, so signer lists can
+// show card details without a libnunchuk lookup per card. With an encrypted
+// database the entries stay in memory only. Missing or stale entries are looked
+// up again on the thread pool; explicit card interactions (import, backup)
+// overwrite them.
+class TapsignerStatusCache
+{
+public:
+    struct Status {
+        QString cardIdent {};
+        QString version {};
+        int     birthHeight {0};
+        int     backups {0};
+        bool    isTestnet {false};
+        qint64  updatedAt {0};
+    };
+    static TapsignerStatusCache *instance();
+
+    bool status(const QString &xfp, Status &out);
+    void update(const QString &xfp, const nunchuk::TapsignerStatus &status);
+    void remove(const QString &xfp);
+
+    static constexpr qint64 STALE_AFTER_SECS = 24 * 60 * 60;
+
+private:
+    TapsignerStatusCache() = default;
+    void refresh(const QString &xfp);
+    void ensureLoaded();
+    void save();
+    static Status convert(const nunchuk::TapsignerStatus &status);
+    static QString filePath();
+
+    QHash<QString, Status>  m_entries;
+    QSet<QString>           m_inFlight;
+    QSet<QString>           m_unknown;
+    QString                 m_loadedPath;
+    bool                    m_persist {false};
+    QMutex                  m_mutex;
+};
+
+#endif // TAPSIGNER_STATUS_CACHE_H
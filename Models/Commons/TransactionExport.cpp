@@ -0,0 +1,140 @@
+#include "TransactionExport.h"
+#include "QExcelWriter.h"
+#include "AppModel.h"
+#include "AppSetting.h"
+#include "nunchuckiface.h"
+#include "QOutlog.h"
+#include "qUtils.h"
+#include <QtConcurrent>
+#include <QDateTime>
+#include <QQmlEngine>
+#include <cmath>
+
+TransactionExport::TransactionExport(QObject *parent) : QObject(parent)
+{
+    QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
+}
+
+TransactionExport *TransactionExport::instance()
+{
+    static TransactionExport mInstance;
+    return &mInstance;
+}
+
+bool TransactionExport::start(const QString &wallet_id, const QString &file_path)
+{
+    if (!m_running.testAndSetOrdered(0, 1)) {
+        DBG_INFO << "Export already running";
+        return false;
+    }
+    m_cancel.storeRelease(0);
+    m_rows.storeRelease(0);
+    emit runningChanged();
+    emit progressChanged();
+    // Rates are read here; the worker must not touch AppModel
+    double fiat_rate = AppModel::instance()->btcRates() / 100000000 * AppModel::instance()->exchangeRates();
+    QString currency = AppSetting::instance()->currency();
+    QtConcurrent::run([this, wallet_id, file_path, fiat_rate, currency]() {
+        QString error_msg = "";
+        bool ok = exportHistory(wallet_id, file_path, fiat_rate, currency, error_msg);
+        m_running.storeRelease(0);
+        emit runningChanged();
+        emit finished(ok, file_path, error_msg);
+    });
+    return true;
+}
+
+void TransactionExport::cancel()
+{
+    m_cancel.storeRelease(1);
+}
+
+bool TransactionExport::running() const
+{
+    return m_running.loadAcquire() != 0;
+}
+
+int TransactionExport::rows() const
+{
+    return m_rows.loadAcquire();
+}
+
+bool TransactionExport::exportHistory(const QString &wallet_id, const QString &file_path, double fiat_rate, const QString &currency, QString &error_msg)
+{
+    QFunctionTime f(QString("Export history %1").arg(wallet_id));
+    QExcelWriter writer(QExcelWriter::formatForPath(file_path));
+    QStringList header {"Transaction ID", "Date", "Status", "Type", "Amount (BTC)", "Fee (BTC)",
+                        QString("Amount (%1)").arg(currency), "Note", "Block height"};
+    if (!writer.open(file_path, header, "Transactions")) {
+        DBG_INFO << "Cannot open" << file_path << writer.errorString();
+        error_msg = writer.errorString();
+        return false;
+    }
+    int skip = 0;
+    while (true) {
+        if (m_cancel.loadAcquire()) {
+            DBG_INFO << "Export cancelled after" << writer.rowCount() << "rows";
+            writer.abort();
+            return false;
+        }
+        QWarningMessage msg;
+        std::vector<nunchuk::Transaction> chunk = nunchukiface::instance()->GetTransactionHistory(wallet_id.toStdString(), CHUNK_ROWS, skip, msg);
+        if ((int)EWARNING::WarningType::NONE_MSG != msg.type()) {
+            DBG_INFO << "Cannot read history" << msg.what();
+            error_msg = msg.what();
+            writer.abort();
+            return false;
+        }
+        for (const nunchuk::Transaction &tx : chunk) {
+            if (!writer.writeRow(row(tx, fiat_rate))) {
+                DBG_INFO << "Cannot write" << file_path << writer.errorString();
+                error_msg = writer.errorString();
+                writer.abort();
+                return false;
+            }
+        }
+        skip += static_cast<int>(chunk.size());
+        m_rows.storeRelease(skip);
+        emit progressChanged();
+        if (static_cast<int>(chunk.size()) < CHUNK_ROWS) {
+            break;
+        }
+    }
+    if (!writer.close()) {
+        DBG_INFO << "Cannot finish" << file_path << writer.errorString();
+        error_msg = writer.errorString();
+        return false;
+    }
+    DBG_INFO << file_path << writer.rowCount() << "rows";
+    return true;
+}
+
+QVariantList TransactionExport::row(const nunchuk::Transaction &tx, double fiat_rate)
+{
+    qint64 amount = tx.get_sub_amount();
+    QString date = tx.get_blocktime() > 0 ? QDateTime::fromTime_t(tx.get_blocktime()).toString(Qt::ISODate) : "";
+    return {
+        QString::fromStdString(tx.get_txid()),
+        date,
+        statusText(tx.get_status()),
+        tx.is_receive() ? "Receive" : "Send",
+        qUtils::QValueFromAmount(amount),
+        qUtils::QValueFromAmount(tx.get_fee()),
+        std::round(amount * fiat_rate * 100) / 100,
+        QString::fromStdString(tx.get_memo()),
+        tx.get_height(),
+    };
+}
+
+QString TransactionExport::statusText(nunchuk::TransactionStatus status)
+{
+    switch (status) {
+    case nunchuk::TransactionStatus::PENDING_SIGNATURES:   return "Pending signatures";
+    case nunchuk::TransactionStatus::READY_TO_BROADCAST:   return "Ready to broadcast";
+    case nunchuk::TransactionStatus::NETWORK_REJECTED:     return "Network rejected";
+    case nunchuk::TransactionStatus::PENDING_CONFIRMATION: return "Pending confirmation";
+    case nunchuk::TransactionStatus::REPLACED:             return "Replaced";
+    case nunchuk::TransactionStatus::CONFIRMED:            return "Confirmed";
+    default:                                               return "";
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef TRANSACTION_EXPORT_H
+#define TRANSACTION_EXPORT_H
+#include <QObject>
+#include <QAtomicInt>
+#include <QStringList>
+#include <QVariantList>
+#include <nunchuk.h>
+
+// Exports a wallet's transaction history to CSV or XLSX (picked from the file
+// extension) on a worker. History is read from libnunchuk CHUNK_ROWS at a time
+// and streamed through QExcelWriter, so neither the history nor the document is
+// held whole. Rows carry the note and the fiat value at the current rate.
+// The CSV columns therefore differ from libnunchuk's ExportTransactionHistory:
+// Transaction ID, Date, Status, Type, Amount (BTC), Fee (BTC), Amount (<currency>),
+// Note, Block height; amounts are unsigned BTC with the direction in Type, written
+// as exact 8-decimal strings built from sats rather than rounded doubles.
+class TransactionExport : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool running READ running NOTIFY runningChanged)
+    Q_PROPERTY(int  rows    READ rows    NOTIFY progressChanged)
+public:
+    static TransactionExport *instance();
+
+    bool start(const QString &wallet_id, const QString &file_path);
+    Q_INVOKABLE void cancel();
+    bool running() const;
+    int  rows() const;
+
+    static constexpr int CHUNK_ROWS = 500;
+
+signals:
+    void runningChanged();
+    void progressChanged();
+    // error_msg is empty when the export was cancelled
+    void finished(bool ok, const QString &file_path, const QString &error_msg);
+
+private:
+    explicit TransactionExport(QObject *parent = nullptr);
+    bool exportHistory(const QString &wallet_id, const QString &file_path, double fiat_rate, const QString &currency, QString &error_msg);
+    static QVariantList row(const nunchuk::Transaction &tx, double fiat_rate);
+    static QString statusText(nunchuk::TransactionStatus status);
+
+    QAtomicInt m_running {0};
+    QAtomicInt m_cancel {0};
+    QAtomicInt m_rows {0};
+};
+
+#endif // TRANSACTION_EXPORT_H
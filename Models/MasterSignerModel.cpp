@@ -22,6 +22,7 @@
 #include "bridgeifaces.h"
 #include "Servers/Draco.h"
 #include "ViewsEnums.h"
+#include "Commons/SignerRegistry.h"
 
 QMasterSigner::QMasterSigner(): isPrimaryKey_(false), isDraft(true)
 {
@@ -357,13 +358,7 @@ QSingleSignerPtr QMasterSigner::cloneSingleSigner()
 
 bool QMasterSigner::isMine() const
 {
-    QWarningMessage msg;
-    std::vector<nunchuk::MasterSigner> signers = bridge::nunchukGetOriginMasterSigners(msg);
-    auto it = std::find_if(signers.begin(), signers.end(), [this](nunchuk::MasterSigner signer) {
-        return signer.get_device().get_master_fingerprint() == fingerPrint().toStdString()
-            || signer.get_id() == fingerPrint().toStdString();
-    });
-    return it != signers.end();
+    return SignerRegistry::instance()->isMasterSigner(fingerPrint());
 }
 
 MasterSignerListModel::MasterSignerListModel() {
@@ -443,6 +438,7 @@ void MasterSignerListModel::addMasterSigner(const QMasterSignerPtr &d)
     beginResetModel();
     if(!contains(d.data()->id())){
         d_.append(d);
+        rebuildIndex();
     }
     endResetModel();
 }
@@ -469,22 +465,13 @@ QMasterSignerPtr MasterSignerListModel::getMasterSignerById(const QString &id)
 
 QMasterSignerPtr MasterSignerListModel::getMasterSignerByXfp(const QString &xfp)
 {
-    foreach (QMasterSignerPtr it, d_) {
-        if(0 == QString::compare(xfp, it.data()->fingerPrint(), Qt::CaseInsensitive)){
-            return it;
-        }
-    }
-    return NULL;
+    return findByXfp(xfp);
 }
 
 QString MasterSignerListModel::getMasterSignerNameByFingerPrint(const QString &fingerprint)
 {
-    foreach (QMasterSignerPtr it, d_) {
-        if(0 == QString::compare(fingerprint, it.data()->fingerPrint(), Qt::CaseInsensitive)){
-            return it.data()->name();
-        }
-    }
-    return "";
+    QMasterSignerPtr it = findByXfp(fingerprint);
+    return it ? it.data()->name() : "";
 }
 
 int MasterSignerListModel::getIndexNameByFingerPrint(const QString &fingerprint)
@@ -503,6 +490,8 @@ bool MasterSignerListModel::removeMasterSigner(const QString &masterSignerId)
     foreach (QMasterSignerPtr it, d_) {
         if(it.data() && it.data()->id() == masterSignerId){
             d_.removeAll(it);
+            rebuildIndex();
+            endResetModel();
             return true;
         }
     }
@@ -557,6 +546,7 @@ bool MasterSignerListModel::removeMasterSigner(const QMasterSignerPtr it)
 {
     beginResetModel();
     d_.removeAll(it);
+    rebuildIndex();
     endResetModel();
     return true;
 }
@@ -573,12 +563,7 @@ bool MasterSignerListModel::contains(const QString &masterSignerId)
 
 bool MasterSignerListModel::containsFingerPrint(const QString &fingerprint)
 {
-    foreach (QMasterSignerPtr i , d_ ){
-        if(0 == QString::compare(fingerprint, i.data()->fingerPrint(), Qt::CaseInsensitive)){
-            return true;
-        }
-    }
-    return false;
+    return !findByXfp(fingerprint).isNull();
 }
 
 void MasterSignerListModel::updateMasterSignerNeedXpubById(const QString &id, const bool value)
@@ -641,12 +626,8 @@ bool MasterSignerListModel::isColdCard(const QString &xfp)
 
 bool MasterSignerListModel::isPrimaryKey(const QString &xfp)
 {
-    foreach (QMasterSignerPtr i , d_ ){
-        if (qUtils::strCompare(xfp, i->fingerPrint())) {
-            return i.data()->isPrimaryKey();
-        }
-    }
-    return false;
+    QMasterSignerPtr it = findByXfp(xfp);
+    return it ? it.data()->isPrimaryKey() : false;
 }
 
 void MasterSignerListModel::requestSort(int role, int order)
@@ -680,9 +661,34 @@ void MasterSignerListModel::cleardata()
 {
     beginResetModel();
     d_.clear();
+    m_indexByXfp.clear();
     endResetModel();
 }
 
+QMasterSignerPtr MasterSignerListModel::findByXfp(const QString &xfp)
+{
+    const QString key = SignerRegistry::normalize(xfp);
+    QMasterSignerPtr it = m_indexByXfp.value(key);
+    if(it && SignerRegistry::normalize(it.data()->fingerPrint()) != key){
+        // A fingerprint was edited in place since the index was built
+        rebuildIndex();
+        it = m_indexByXfp.value(key);
+    }
+    return it;
+}
+
+void MasterSignerListModel::rebuildIndex()
+{
+    m_indexByXfp.clear();
+    m_indexByXfp.reserve(d_.count());
+    for (const QMasterSignerPtr &it : d_) {
+        const QString key = SignerRegistry::normalize(it.data()->fingerPrint());
+        if(!key.isEmpty() && !m_indexByXfp.contains(key)){
+            m_indexByXfp.insert(key, it);
+        }
+    }
+}
+
 int MasterSignerListModel::signerCount() const
 {
     return d_.count();
@@ -226,7 +226,11 @@ public slots:
     int signerCount() const;
     int signerSelectedCount() const;
 private:
+    QMasterSignerPtr findByXfp(const QString &xfp);
+    void rebuildIndex();
     QList<QMasterSignerPtr> d_;
+    // Normalized fingerprint -> signer; membership changes rebuild it, hits are re-checked
+    QHash<QString, QMasterSignerPtr> m_indexByXfp;
 };
 typedef QSharedPointer<MasterSignerListModel> QMasterSignerListModelPtr;
 
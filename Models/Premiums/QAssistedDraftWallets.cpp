@@ -13,6 +13,8 @@
 #include "Premiums/QGroupWalletDummyTx.h"
 #include "Premiums/QUserWalletDummyTx.h"
 #include "Premiums/QGroupWallets.h"
+#include "Commons/FanOut.h"
+#include <QMutex>
 
 const QMap<Key, StructAddHardware> map_keys = {
     {Key::ADD_LEDGER,   {"LEDGER",   "ledger",   STR_CPP_122, STR_CPP_121, 124}},
@@ -68,19 +70,24 @@ void QAssistedDraftWallets::GetListAllRequestAddKey(const QJsonArray& groups)
         });
     }
     else if (m_mode == GROUP_WALLET) {
-        QJsonObject data;
-        QString error_msg;
         m_requests.clear();
+        QStringList group_ids;
         for (QJsonValue js : groups) {
             QJsonObject group = js.toObject();
             QString status = group["status"].toString();
             if (status == "PENDING_WALLET") {
-                QString group_id = group["id"].toString();
-                Byzantine::instance()->GetAllListRequestAddKey(group_id, data, error_msg);
-                addRequest(data.value("requests").toArray(), group_id);
-                DBG_INFO << group_id << data;
+                group_ids.append(group["id"].toString());
             }
         }
+        QMutex mutex;
+        FanOut::run("GetAllListRequestAddKey", group_ids, [&](const QString &group_id) {
+            QJsonObject data;
+            QString error_msg;
+            Byzantine::instance()->GetAllListRequestAddKey(group_id, data, error_msg);
+            QMutexLocker locker(&mutex);
+            addRequest(data.value("requests").toArray(), group_id);
+            DBG_INFO << group_id << data;
+        }, GROUP_FANOUT_CONCURRENCY);
         makeListRequests();
     } else {
         return;
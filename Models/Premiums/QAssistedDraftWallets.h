@@ -55,6 +55,8 @@ public:
     QString typeReq() const;
 
     // For draft-wallets
+    // Requests for several groups are fetched concurrently, at most this many at a time
+    static constexpr int GROUP_FANOUT_CONCURRENCY = 4;
     void GetListAllRequestAddKey(const QJsonArray& groups = {});
     virtual bool AddOrUpdateAKeyToDraftWallet();
     virtual bool AddOrUpdateReuseKeyToDraftWallet(nunchuk::SingleSigner keyresued);
@@ -14,6 +14,7 @@
 #include "Premiums/QRecurringPayment.h"
 #include "Premiums/QGroupWallets.h"
 #include "Premiums/QUserWallets.h"
+#include "Commons/OffsetPager.h"
 
 int StringToInt(const QString &type) {
     const QMetaObject &mo = AlertEnum::staticMetaObject;
@@ -72,6 +73,7 @@ void QGroupDashboard::setGroupInfo(const QJsonObject &groupInfo)
                 setMyInfo(member);
             }
         }
+        updateMemberModels();
         emit groupInfoChanged();
     }
 }
@@ -156,6 +158,22 @@ QVariantList QGroupDashboard::memberSignatures()
     return result.toVariantList();
 }
 
+JsonListModel *QGroupDashboard::membersModel() const
+{
+    return m_membersModel.data();
+}
+
+JsonListModel *QGroupDashboard::memberSignaturesModel() const
+{
+    return m_memberSignaturesModel.data();
+}
+
+void QGroupDashboard::updateMemberModels()
+{
+    m_membersModel->setItems(QJsonArray::fromVariantList(members()));
+    m_memberSignaturesModel->setItems(QJsonArray::fromVariantList(memberSignatures()));
+}
+
 QVariant QGroupDashboard::inviter() const
 {
     return QVariant::fromValue(inviterInfo());
@@ -180,41 +198,140 @@ void QGroupDashboard::GetMemberInfo()
 void QGroupDashboard::GetAlertsInfo()
 {
     if (isReplaced()) return;
-    QJsonObject output;
-    QString error_msg = "";
-    bool ret {false};
+    QString key = alertStoreKey();
+    bool first {false};
+    bool stale {true};
+    QString newest = "";
+    int edits {0};
+    {
+        QMutexLocker locker(&m_alertMutex);
+        first = m_alertStore.key() != key;
+        if (first) {
+            m_alertStore.setKey(key);
+            if (m_alertStore.load()) {
+                // Render the cached alerts right away, the sync below corrects them
+                publishAlerts();
+                first = false;
+            }
+        }
+        stale = m_alertStore.isStale() || m_alertStore.isEmpty();
+        newest = m_alertStore.newestId();
+        edits = m_alertEdits;
+    }
+    // The round trips run unlocked so dismissing or reading an alert never waits on them
+    QJsonArray fresh;
+    bool full {false};
+    if (!FetchAlerts(stale, newest, fresh, full)) {
+        //Show error
+        return;
+    }
+    QMutexLocker locker(&m_alertMutex);
+    if (m_alertStore.key() != key || m_alertEdits != edits) {
+        // Edited locally (or switched) while fetching; have the next sync re-walk instead
+        m_alertStore.markStale();
+        return;
+    }
+    bool changed {false};
+    if (full) {
+        changed = fresh != m_alertStore.alerts();
+        m_alertStore.replace(fresh);
+    }
+    else {
+        changed = !fresh.isEmpty();
+        m_alertStore.prepend(fresh);
+    }
+    if (changed || first) {
+        m_alertStore.save();
+        publishAlerts();
+    }
+}
+
+QString QGroupDashboard::alertStoreKey()
+{
     if (isDraftWallet()) {
-        ret = Draco::instance()->DraftWalletGetAlerts(output, error_msg);
+        return "draft";
     }
     else if (isUserWallet()) {
-        ret = Draco::instance()->GetAlerts(wallet_id(), output, error_msg);
+        return QString("wallet_%1").arg(wallet_id());
     }
-    else {
-        ret = Byzantine::instance()->GetGroupAlerts(groupId(), output, error_msg);
+    return QString("group_%1").arg(groupId());
+}
+
+bool QGroupDashboard::GetAlertsPage(int offset, int limit, QJsonArray &alerts)
+{
+    QString error_msg = "";
+    if (isDraftWallet()) {
+        return Draco::instance()->DraftWalletGetAlertsPage(offset, limit, alerts, error_msg);
     }
-    DBG_INFO << ret << output;
-    if(ret){
-        // Handle preparing model here.
-        QJsonArray   alerts  = output["alerts"].toArray();
-        QJsonArray v_alerts;
-        for (auto js : alerts) {
-            QJsonObject alert = js.toObject();
-            long int created_time_millis = static_cast<long int>(alert.value("created_time_millis").toDouble()/1000);
-            QDateTime date_time = QDateTime::fromTime_t(created_time_millis);
-            alert["created_time_millis"] = QString("%1 at %2")
-                                               .arg(date_time.date().toString("MM/dd/yyyy"))
-                                               .arg(date_time.time().toString("hh:mm AP"));
-            QString type = alert["type"].toString();
-            alert["type"] = StringToInt(type);
-            v_alerts.append(alert);
+    else if (isUserWallet()) {
+        return Draco::instance()->GetAlertsPage(wallet_id(), offset, limit, alerts, error_msg);
+    }
+    return Byzantine::instance()->GetGroupAlertsPage(groupId(), offset, limit, alerts, error_msg);
+}
+
+bool QGroupDashboard::FetchAlerts(bool stale, const QString &newest, QJsonArray &alerts, bool &full)
+{
+    auto fetch = [this](int offset, int limit, QJsonArray &page) {
+        return GetAlertsPage(offset, limit, page);
+    };
+    QJsonArray fresh;
+    if (!stale && !newest.isEmpty()) {
+        // Pull pages only until the newest alert we already hold shows up
+        bool reached {false};
+        OffsetPager::Cursor cursor;
+        OffsetPager head("alerts head " + alertStoreKey(), fetch, ALERTS_PAGE_SIZE, ALERTS_PAGE_SIZE, 0);
+        bool ret = head.run([&](const QJsonArray &page) {
+            for (auto js : page) {
+                if (js.toObject()["id"].toString() == newest) {
+                    reached = true;
+                    return false;
+                }
+                fresh.append(js);
+            }
+            return true;
+        }, &cursor);
+        if (!ret) return false;
+        // Older alerts are rechecked by the periodic full walk (see AlertStore::isStale)
+        if (reached || cursor.finished) {
+            // Without reaching the newest alert, a finished walk already covered the whole list
+            alerts = fresh;
+            full = !reached;
+            return true;
         }
-        output["alerts"] = v_alerts;
-        m_alertInfo = output;
-        emit alertInfoChanged();
+        fresh = QJsonArray();
     }
-    else{
-        //Show error
+    OffsetPager walk("alerts " + alertStoreKey(), fetch, ALERTS_PAGE_SIZE);
+    bool ret = walk.run([&](const QJsonArray &page) {
+        for (auto js : page) {
+            fresh.append(js);
+        }
+        return true;
+    });
+    if (!ret) return false;
+    alerts = fresh;
+    full = true;
+    return true;
+}
+
+void QGroupDashboard::publishAlerts()
+{
+    QJsonArray v_alerts;
+    for (auto js : m_alertStore.alerts()) {
+        QJsonObject alert = js.toObject();
+        long int created_time_millis = static_cast<long int>(alert.value("created_time_millis").toDouble()/1000);
+        QDateTime date_time = QDateTime::fromTime_t(created_time_millis);
+        alert["created_time_millis"] = QString("%1 at %2")
+                                           .arg(date_time.date().toString("MM/dd/yyyy"))
+                                           .arg(date_time.time().toString("hh:mm AP"));
+        QString type = alert["type"].toString();
+        alert["type"] = StringToInt(type);
+        v_alerts.append(alert);
     }
+    QJsonObject output;
+    output["alerts"] = v_alerts;
+    m_alertInfo = output;
+    m_alertsModel->setItems(v_alerts);
+    emit alertInfoChanged();
 }
 
 bool QGroupDashboard::MarkAlertAsRead(const QString &alert_id)
@@ -233,7 +350,10 @@ bool QGroupDashboard::MarkAlertAsRead(const QString &alert_id)
     }
     DBG_INFO << ret << error_msg;
     if(ret){
-        // Handle preparing model here.
+        // The read flag lives in the alert body; have the next sync take a full copy
+        QMutexLocker locker(&m_alertMutex);
+        m_alertStore.markStale();
+        m_alertEdits++;
     }
     else{
         //Show error
@@ -256,7 +376,12 @@ bool QGroupDashboard::DismissAlert(const QString &alert_id)
         ret = Byzantine::instance()->DismissGroupAlert(groupId(), alert_id, output, error_msg);
     }
     if(ret){
-        // Handle preparing model here.
+        QMutexLocker locker(&m_alertMutex);
+        m_alertEdits++;
+        if (m_alertStore.remove(alert_id)) {
+            m_alertStore.save();
+            publishAlerts();
+        }
     }
     else{
         //Show error
@@ -490,6 +615,7 @@ QJsonObject QGroupDashboard::myInfo() const
 void QGroupDashboard::setMyInfo(const QJsonObject &myInfo)
 {
     m_myInfo = myInfo;
+    updateMemberModels();
     emit groupInfoChanged();
 }
 
@@ -1239,9 +1365,9 @@ QVariantList QGroupDashboard::keys() const
     return m_keys;
 }
 
-QVariantList QGroupDashboard::alerts() const
+JsonListModel *QGroupDashboard::alertsModel() const
 {
-    return m_alertInfo["alerts"].toArray().toVariantList();
+    return m_alertsModel.data();
 }
 
 QVariant QGroupDashboard::alert() const
@@ -7,6 +7,9 @@
 #include "TypeDefine.h"
 #include <nunchuk.h>
 #include "Premiums/QBasePremium.h"
+#include "Commons/AlertStore.h"
+#include "Commons/JsonListModel.h"
+#include <QMutex>
 
 class AlertEnum : public QObject
 {
@@ -93,15 +96,15 @@ class QGroupDashboard : public QBasePremium
     Q_PROPERTY(QString userName                   READ userName                                 NOTIFY groupInfoChanged)
     Q_PROPERTY(QString userEmail                  READ userEmail                                NOTIFY groupInfoChanged)
 
-    Q_PROPERTY(QVariantList members               READ members                                  NOTIFY groupInfoChanged)
-    Q_PROPERTY(QVariantList memberSignatures      READ memberSignatures                         NOTIFY groupInfoChanged)
+    Q_PROPERTY(JsonListModel* members             READ membersModel                             CONSTANT)
+    Q_PROPERTY(JsonListModel* memberSignatures    READ memberSignaturesModel                    CONSTANT)
     Q_PROPERTY(QVariant inviter                   READ inviter                                  NOTIFY groupInfoChanged)
     Q_PROPERTY(QVariant myInfoModel               READ myInfoModel                              NOTIFY groupInfoChanged)
     Q_PROPERTY(bool isLocked                      READ isLocked                                 NOTIFY groupInfoChanged)
 
     Q_PROPERTY(QVariantList keys                  READ keys                                     NOTIFY draftWalletChanged)
     Q_PROPERTY(bool hasWallet                     READ hasWallet                                NOTIFY groupInfoChanged)
-    Q_PROPERTY(QVariantList alerts                READ alerts                                   NOTIFY alertInfoChanged)
+    Q_PROPERTY(JsonListModel* alerts              READ alertsModel                              CONSTANT)
     Q_PROPERTY(QVariant alert                     READ alert                                    NOTIFY alertInfoChanged)
     Q_PROPERTY(bool isShowDashBoard               READ showDashBoard  WRITE setShowDashBoard    NOTIFY showDashBoardChanged)
     Q_PROPERTY(int mInfo                          READ mInfo                                    NOTIFY draftWalletChanged)
@@ -134,6 +137,8 @@ public:
     QString userEmail() const;
     QVariantList members() const;
     QVariantList memberSignatures();
+    JsonListModel* membersModel() const;
+    JsonListModel* memberSignaturesModel() const;
     QVariant inviter() const;
     QJsonObject walletJson() const;
     void GetMemberInfo();
@@ -147,7 +152,7 @@ public:
     void GetHealthCheckInfo();
     void UpdateKeys(const QJsonObject &data);
 
-    QVariantList alerts() const;
+    JsonListModel* alertsModel() const;
     QVariant alert() const;
     QJsonObject alertJson() const;
     QVariantList keys() const;
@@ -240,6 +245,11 @@ private:
     bool deviceExport(const QStringList tags, nunchuk::SignerType type);
     bool xfpExport(const QString xfp);
     QVariant health() const;
+    QString alertStoreKey();
+    bool GetAlertsPage(int offset, int limit, QJsonArray &alerts);
+    bool FetchAlerts(bool stale, const QString &newest, QJsonArray &alerts, bool &full);
+    void publishAlerts();
+    void updateMemberModels();
 signals:
     void groupInfoChanged();
     void draftWalletChanged();
@@ -256,6 +266,13 @@ signals:
 private:
     QJsonObject m_groupInfo {};
     QJsonObject m_alertInfo {};
+    AlertStore m_alertStore {};
+    QJsonListModelPtr m_alertsModel {new JsonListModel({"id"})};
+    QJsonListModelPtr m_membersModel {new JsonListModel({"membership_id", "email_or_username"})};
+    QJsonListModelPtr m_memberSignaturesModel {new JsonListModel({"membership_id", "email_or_username"})};
+    QMutex m_alertMutex;
+    // Bumped by local dismiss/read under m_alertMutex; a sync that overlapped one is dropped
+    int m_alertEdits {0};
     QJsonObject m_walletInfo {};
     QJsonObject m_myInfo {};
     QJsonObject m_inviterInfo {};
@@ -3,6 +3,7 @@
 #include "QEventProcessor.h"
 #include "ViewsEnums.h"
 #include "Premiums/QUserWallets.h"
+#include "Commons/FanOut.h"
 
 QGroupWallets::QGroupWallets()
     : QAssistedDraftWallets(GROUP_WALLET)
@@ -216,13 +217,21 @@ void QGroupWallets::dashboard(const QString &group_id, const QString& wallet_id)
     DBG_INFO << mDashboard;
     if (mDashboard) {
         mDashboard->setShowDashBoard(true);
-        QtConcurrent::run([this]() {
-            if(mDashboard){
-                mDashboard->GetAlertsInfo();
-                mDashboard->GetMemberInfo();
-                mDashboard->GetWalletInfo();
-                mDashboard->GetHealthCheckInfo();
-            }
+        QGroupDashboardPtr info = mDashboard;
+        QtConcurrent::run([info]() {
+            // Members and wallet write the dashboard's group/wallet JSON that alerts and
+            // health read (groupId, isReplaced, walletJson), so they load first; the two
+            // readers then run side by side, each writing only its own model
+            info->GetMemberInfo();
+            info->GetWalletInfo();
+            FanOut::run("dashboard " + info->groupId(), {"alerts", "health"}, [info](const QString &part) {
+                if (part == "alerts") {
+                    info->GetAlertsInfo();
+                }
+                else {
+                    info->GetHealthCheckInfo();
+                }
+            }, GROUP_FANOUT_CONCURRENCY);
         });
     }
 }
@@ -69,9 +69,15 @@ void QRecurringPayment::setPaymentList(const QJsonArray &list)
         return;
 
     m_payment_list = list;
+    m_paymentListModel->setItems(list);
     emit paymentListChanged();
 }
 
+JsonListModel *QRecurringPayment::paymentListModel() const
+{
+    return m_paymentListModel.data();
+}
+
 QVariant QRecurringPayment::paymentCurrent() const
 {
     return QVariant::fromValue(m_payment);
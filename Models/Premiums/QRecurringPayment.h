@@ -6,6 +6,7 @@
 #include <QStack>
 #include "TypeDefine.h"
 #include "Premiums/QBasePremium.h"
+#include "Commons/JsonListModel.h"
 #include <nunchuk.h>
 
 class PaymentEnum : public QObject
@@ -41,7 +42,7 @@ class QRecurringPayment : public QBasePremium
     Q_OBJECT
     Q_PROPERTY(int flow                 READ flow               NOTIFY flowChanged)
     Q_PROPERTY(QVariant payment         READ paymentCurrent     NOTIFY paymentCurrentChanged)
-    Q_PROPERTY(QVariantList paymentList READ paymentList        NOTIFY paymentListChanged)
+    Q_PROPERTY(JsonListModel* paymentList READ paymentListModel CONSTANT)
     Q_PROPERTY(QString sortOption       READ sortOption         NOTIFY sortOptionChanged)
 public:
     explicit QRecurringPayment(WalletId wallet_id);
@@ -55,6 +56,7 @@ Flow_Payment:
 Property_Payment:
     QString sortOption() const;
     QVariantList paymentList() const;
+    JsonListModel* paymentListModel() const;
     void setPaymentList(const QJsonArray &list);
 
     QVariant paymentCurrent() const;
@@ -101,6 +103,7 @@ private:
     QStack<int> m_flows;
     bool m_has_server_key {false};
     QJsonArray m_payment_list {};
+    QJsonListModelPtr m_paymentListModel {new JsonListModel({"id"})};
     QJsonObject m_payment {};
     QString m_sortOption {"newest"};
 };
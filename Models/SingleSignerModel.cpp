@@ -26,6 +26,8 @@
 #include "Servers/Draco.h"
 #include "AppModel.h"
 #include "ViewsEnums.h"
+#include "Commons/TapsignerStatusCache.h"
+#include "Commons/SignerRegistry.h"
 
 QSingleSigner::QSingleSigner()
     : isPrimaryKey_(false)
@@ -338,24 +340,14 @@ bool QSingleSigner::isLocalSigner()
 {
     bool isLocal = false;
     if(signerType() != (int)ENUNCHUCK::SignerType::SERVER){
-        if(AppModel::instance()->masterSignerList()){
-            isLocal = AppModel::instance()->masterSignerList()->containsFingerPrint(masterFingerPrint());
-        }
-        if(!isLocal && AppModel::instance()->remoteSignerList()){
-            isLocal = AppModel::instance()->remoteSignerList()->containsFingerPrint(masterFingerPrint());
-        }
+        isLocal = SignerRegistry::instance()->isLocal(masterFingerPrint());
     }
     return isLocal;
 }
 
 bool QSingleSigner::isMine() const
 {
-    QWarningMessage msg;
-    std::vector<nunchuk::SingleSigner> signers = bridge::nunchukGetOriginRemoteSigners(msg);
-    auto it = std::find_if(signers.begin(), signers.end(), [this](const nunchuk::SingleSigner& signer) {
-        return signer.get_master_fingerprint() == masterFingerPrint().toStdString();
-    });
-    return it != signers.end();
+    return SignerRegistry::instance()->isRemoteSigner(masterFingerPrint());
 }
 
 bool QSingleSigner::isPrimaryKey() const
@@ -387,8 +379,18 @@ QString QSingleSigner::cardId()
 {
     if((int)ENUNCHUCK::SignerType::NFC == signerType()){
         if (cardId_.isEmpty()) {
-            nunchuk::TapsignerStatus tapsigner = bridge::GetTapsignerStatusFromMasterSigner(masterFingerPrint());
-            cardId_ = QString::fromStdString(tapsigner.get_card_ident());
+            TapsignerStatusCache::Status cached;
+            if (TapsignerStatusCache::instance()->status(masterFingerPrint(), cached)) {
+                cardId_ = cached.cardIdent;
+            }
+            else {
+                // Card id is uploaded with the signer, so a first miss still looks it up in place
+                nunchuk::TapsignerStatus tapsigner = bridge::GetTapsignerStatusFromMasterSigner(masterFingerPrint());
+                cardId_ = QString::fromStdString(tapsigner.get_card_ident());
+                if (!cardId_.isEmpty()) {
+                    TapsignerStatusCache::instance()->update(masterFingerPrint(), tapsigner);
+                }
+            }
         }
     }
     return cardId_;
@@ -871,14 +873,9 @@ bool SingleSignerListModel::containsFingerPrint(const QString &masterFingerPrint
 
 bool SingleSignerListModel::checkUsableToSign(const QString &masterFingerPrint)
 {
-    bool isContains = containsFingerPrint(masterFingerPrint);
-    if(isContains){
-        foreach (QSingleSignerPtr i , d_ ){
-            if(0 == QString::compare(masterFingerPrint, i.data()->masterFingerPrint(), Qt::CaseInsensitive)) {
-                if(!i.data()->signerSigned()){
-                    return true;
-                }
-            }
+    foreach (QSingleSignerPtr i , d_ ){
+        if(!i.data()->signerSigned() && 0 == QString::compare(masterFingerPrint, i.data()->masterFingerPrint(), Qt::CaseInsensitive)) {
+            return true;
         }
     }
     return false;
@@ -26,6 +26,9 @@
 #include "Chats/matrixbrigde.h"
 #include "AppModel.h"
 #include <QQmlEngine>
+#include <QSet>
+#include <QPointer>
+#include <QtConcurrent>
 #include <nunchukmatrix.h>
 #include "Servers/Byzantine.h"
 #include "Premiums/QGroupDashboard.h"
@@ -34,7 +37,7 @@ Destination::Destination(): address_(""), amount_(0){
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
 }
 
-Destination::Destination(const QString &address, const qint64 amount) : address_(address), amount_(amount){
+Destination::Destination(const QString &address, const qint64 amount, bool isMine) : address_(address), amount_(amount), isMine_(isMine){
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
 }
 
@@ -42,23 +45,40 @@ Destination::~Destination() {}
 
 QString Destination::amountDisplay() const
 {
-    if((int)AppSetting::Unit::SATOSHI == AppSetting::instance()->unit()){
-        QLocale locale(QLocale::English);
-        return locale.toString(amountSats());
-    }
-    else{
-        return amountBTC();
-    }
+    updateDisplay();
+    return amountDisplay_;
 }
 
 QString Destination::amountBTC() const
 {
-    return qUtils::QValueFromAmount(amount_);
+    updateDisplay();
+    return amountBTC_;
 }
 
 QString Destination::amountCurrency() const
 {
-    return qUtils::currencyLocale(amountSats());
+    updateDisplay();
+    return amountCurrency_;
+}
+
+void Destination::updateDisplay() const
+{
+    const int unit = AppSetting::instance()->unit();
+    const double rate = AppModel::instance()->btcRates() * AppModel::instance()->exchangeRates();
+    if(displayUnit_ == unit && displayRate_ == rate){
+        return;
+    }
+    displayUnit_ = unit;
+    displayRate_ = rate;
+    amountBTC_ = qUtils::QValueFromAmount(amount_);
+    if((int)AppSetting::Unit::SATOSHI == unit){
+        QLocale locale(QLocale::English);
+        amountDisplay_ = locale.toString(amount_);
+    }
+    else{
+        amountDisplay_ = amountBTC_;
+    }
+    amountCurrency_ = qUtils::currencyLocale(amount_);
 }
 
 qint64 Destination::amountSats() const
@@ -80,10 +100,24 @@ void Destination::setAddress(const QString &value){
 void Destination::setAmount(const qint64 value){
     if(value != amount_){
         amount_ = value;
+        displayUnit_ = -1;
         emit amountChanged();
     }
 }
 
+bool Destination::isMine() const
+{
+    return isMine_;
+}
+
+void Destination::setIsMine(bool value)
+{
+    if(value != isMine_){
+        isMine_ = value;
+        emit isMineChanged();
+    }
+}
+
 DestinationListModel::DestinationListModel(){
     QQmlEngine::setObjectOwnership(this, QQmlEngine::CppOwnership);
 }
@@ -105,6 +139,8 @@ QVariant DestinationListModel::data(const QModelIndex &index, int role) const {
         return m_data[index.row()]->amountBTC();
     case destination_amount_currency_role:
         return m_data[index.row()]->amountCurrency();
+    case destination_is_mine_role:
+        return m_data[index.row()]->isMine();
     default:
         return QVariant();
     }
@@ -116,6 +152,7 @@ QHash<int, QByteArray> DestinationListModel::roleNames() const {
     roles[destination_amount_role] = "destination_amount";
     roles[destination_amount_btc_role] = "destination_amount_btc";
     roles[destination_amount_currency_role] = "destination_amount_currency";
+    roles[destination_is_mine_role] = "destination_is_mine";
     return roles;
 }
 
@@ -128,6 +165,44 @@ void DestinationListModel::addDestination(const QString &address, const qint64 a
     }
 }
 
+void DestinationListModel::updateDestinations(const QList<Output> &outputs)
+{
+    // Same first-address-wins rule as addDestination()
+    QList<Output> unique;
+    QSet<QString> seen;
+    for (const Output &o : outputs) {
+        if(!seen.contains(o.address)){
+            seen.insert(o.address);
+            unique.append(o);
+        }
+    }
+    const int common = qMin(m_data.count(), unique.count());
+    for (int i = 0; i < common; i++) {
+        Destination *d = m_data.at(i).data();
+        const Output &o = unique.at(i);
+        if(d->address() != o.address || d->amountSats() != o.amount || d->isMine() != o.isMine){
+            d->setAddress(o.address);
+            d->setAmount(o.amount);
+            d->setIsMine(o.isMine);
+            emit dataChanged(index(i), index(i));
+        }
+    }
+    if(unique.count() < m_data.count()){
+        beginRemoveRows(QModelIndex(), unique.count(), m_data.count() - 1);
+        m_data.erase(m_data.begin() + unique.count(), m_data.end());
+        endRemoveRows();
+    }
+    else if(unique.count() > m_data.count()){
+        const int first = m_data.count();
+        beginInsertRows(QModelIndex(), first, unique.count() - 1);
+        for (int i = first; i < unique.count(); i++) {
+            const Output &o = unique.at(i);
+            m_data.append(QDestinationPtr(new Destination(o.address, o.amount, o.isMine)));
+        }
+        endInsertRows();
+    }
+}
+
 QMap<QString, qint64> DestinationListModel::getOutputs() const
 {
     QMap<QString, qint64> outputs;
@@ -212,6 +287,7 @@ bool Transaction::isReceiveTx() const
 void Transaction::setIsReceiveTx(bool receive)
 {
     m_transaction.set_receive(receive);
+    invalidateDisplay();
     emit isReceiveTxChanged();
 }
 
@@ -286,6 +362,7 @@ qint64 Transaction::feeSats() const
 void Transaction::setFee(const qint64 fee)
 {
     m_transaction.set_fee(fee);
+    invalidateDisplay();
     emit feeChanged();
 }
 
@@ -485,14 +562,9 @@ bool Transaction::hasChange() const {
 }
 
 Destination *Transaction::change() {
-    if(!m_change){
-        m_change = QDestinationPtr(new Destination());
-    }
-    int index_change = m_transaction.get_change_index();
-    if(index_change >= 0 && index_change < (int)m_transaction.get_outputs().size()) {
-        std::pair<std::string, int> change_ret = m_transaction.get_outputs().at(index_change);
-        m_change.data()->setAddress(QString::fromStdString(change_ret.first));
-        m_change.data()->setAmount(change_ret.second);
+    m_outputsShown = true;
+    if(m_outputsDirty || !m_change){
+        updateOutputs();
     }
     return m_change.data();
 }
@@ -521,6 +593,8 @@ void Transaction::setWalletId(const QString &walletId)
 {
     if(m_walletId != walletId){
         m_walletId = walletId;
+        m_mineAddresses.clear();
+        invalidateDisplay();
         emit walletIdChanged();
     }
 }
@@ -663,29 +737,99 @@ QString Transaction::totalBTC() const
 }
 
 DestinationListModel *Transaction::destinationList() {
+    m_outputsShown = true;
+    if(m_outputsDirty || !m_destinations){
+        updateOutputs();
+    }
+    return m_destinations.data();
+}
+
+void Transaction::updateOutputs()
+{
+    m_outputsDirty = false;
     if(!m_destinations){
         m_destinations = QDestinationListModelPtr(new DestinationListModel());
     }
-    m_destinations.data()->clearAll();
+    m_destinations.data()->updateDestinations(destinationOutputs());
+    if(!m_change){
+        m_change = QDestinationPtr(new Destination());
+    }
+    int index_change = m_transaction.get_change_index();
+    if(index_change >= 0 && index_change < (int)m_transaction.get_outputs().size()) {
+        nunchuk::TxOutput change_ret = m_transaction.get_outputs().at(index_change);
+        m_change.data()->setAddress(QString::fromStdString(change_ret.first));
+        m_change.data()->setAmount(change_ret.second);
+        m_change.data()->setIsMine(true);
+    }
+}
 
-    std::vector<nunchuk::TxOutput> addrs;
+QList<DestinationListModel::Output> Transaction::destinationOutputs()
+{
+    QList<DestinationListModel::Output> outputs;
     if(isReceiveTx()){
-        addrs = m_transaction.get_receive_outputs();
-        for (std::pair<std::string, nunchuk::Amount> item : addrs) {
-            m_destinations.data()->addDestination(QString::fromStdString(item.first), item.second);
+        for (const nunchuk::TxOutput &item : m_transaction.get_receive_outputs()) {
+            outputs.append({QString::fromStdString(item.first), item.second, true});
         }
+        return outputs;
     }
-    else{
-        addrs = m_transaction.get_outputs();
-        int index_change = m_transaction.get_change_index();
-        for (int i = 0; i < (int)addrs.size(); i++){
-            if(index_change != i){
-                std::pair<std::string, nunchuk::Amount> item = addrs.at(i);
-                m_destinations.data()->addDestination(QString::fromStdString(item.first), item.second);
-            }
+    const std::vector<nunchuk::TxOutput> &addrs = m_transaction.get_outputs();
+    int index_change = m_transaction.get_change_index();
+    outputs.reserve((int)addrs.size());
+    QStringList unknown;
+    for (int i = 0; i < (int)addrs.size(); i++){
+        if(index_change == i){
+            continue;
         }
+        const QString address = QString::fromStdString(addrs.at(i).first);
+        // Ownership of an address never changes, so each one is asked once per transaction;
+        // until the answer arrives the output is shown as not ours
+        auto mine = m_mineAddresses.constFind(address);
+        if(mine == m_mineAddresses.constEnd()){
+            unknown.append(address);
+        }
+        outputs.append({address, addrs.at(i).second, mine != m_mineAddresses.constEnd() && mine.value()});
     }
-    return m_destinations.data();
+    if(!unknown.isEmpty() && !m_walletId.isEmpty()){
+        resolveOwnership(unknown);
+    }
+    return outputs;
+}
+
+void Transaction::resolveOwnership(const QStringList &addresses)
+{
+    if(m_resolvingOwnership){
+        return;
+    }
+    m_resolvingOwnership = true;
+    // One libnunchuk round per address; ask for all of them together on the thread pool
+    QPointer<Transaction> self(this);
+    QString wallet_id = m_walletId;
+    QtConcurrent::run([self, wallet_id, addresses]() {
+        QHash<QString, bool> mine;
+        for (const QString &address : addresses) {
+            QWarningMessage msg;
+            mine.insert(address, bridge::IsMyAddress(wallet_id, address, msg));
+        }
+        QMetaObject::invokeMethod(qApp, [self, wallet_id, mine]() {
+            if(!self){
+                return;
+            }
+            self->m_resolvingOwnership = false;
+            if(self->m_walletId != wallet_id){
+                // setWalletId dropped the cache; the next read asks again
+                if(self->m_outputsShown){
+                    self->updateOutputs();
+                }
+                return;
+            }
+            for (auto it = mine.constBegin(); it != mine.constEnd(); ++it) {
+                self->m_mineAddresses.insert(it.key(), it.value());
+            }
+            if(self->m_outputsShown){
+                self->updateOutputs();
+            }
+        }, Qt::QueuedConnection);
+    });
 }
 
 QString Transaction::get_replaced_by_txid() const
@@ -703,9 +847,67 @@ nunchuk::Transaction Transaction::nunchukTransaction() const
     return m_transaction;
 }
 
+TransactionRow Transaction::snapshotRow()
+{
+    return rowOf(m_transaction);
+}
+
+TransactionRow Transaction::rowOf(const nunchuk::Transaction &tx)
+{
+    TransactionRow row;
+    row.txid = QString::fromStdString(tx.get_txid());
+    row.memo = QString::fromStdString(tx.get_memo());
+    row.destination = destinationOf(tx);
+    row.replacedByTxid = QString::fromStdString(tx.get_replaced_by_txid());
+    row.fee = tx.get_fee();
+    row.subtotal = tx.get_sub_amount();
+    row.blocktime = tx.get_blocktime();
+    row.status = (int)tx.get_status();
+    row.m = tx.get_m();
+    row.height = tx.get_height();
+    int index_change = tx.get_change_index();
+    row.hasChange = index_change >= 0 && index_change < (int)tx.get_outputs().size();
+    row.isReceive = tx.is_receive();
+    row.isRbf = !tx.get_replace_txid().empty();
+    // numberSigned() also refreshes the UTXO selection; only the count is wanted here
+    for (const auto &signer : tx.get_signers()) {
+        if(signer.second) { row.numberSigned++; }
+    }
+    return row;
+}
+
 void Transaction::setNunchukTransaction(const nunchuk::Transaction &tx)
 {
     m_transaction = tx;
+    invalidateDisplay();
+}
+
+const Transaction::Display &Transaction::display()
+{
+    const int unit = AppSetting::instance()->unit();
+    const double rate = AppModel::instance()->btcRates() * AppModel::instance()->exchangeRates();
+    if(m_display.unit != unit || m_display.rate != rate){
+        m_display.unit = unit;
+        m_display.rate = rate;
+        m_display.fee = feeDisplay();
+        m_display.subtotal = subtotalDisplay();
+        m_display.total = totalDisplay();
+        m_display.subtotalCurrency = subtotalCurrency();
+        m_display.totalCurrency = totalCurrency();
+        m_display.blocktime = blocktimeDisplay();
+        m_display.destination = destination();
+    }
+    return m_display;
+}
+
+void Transaction::invalidateDisplay()
+{
+    m_display.unit = -1;
+    m_outputsDirty = true;
+    // A screen already shows the outputs; update its rows in place instead of on the next read
+    if(m_outputsShown){
+        updateOutputs();
+    }
 }
 
 QString Transaction::roomId()
@@ -793,17 +995,22 @@ void Transaction::setPackageFeeRate(int satvKB)
 }
 
 QString Transaction::destination()
+{
+    return destinationOf(m_transaction);
+}
+
+QString Transaction::destinationOf(const nunchuk::Transaction &tx)
 {
     QString ret = "";
     std::vector<nunchuk::TxOutput> addrs;
-    if(isReceiveTx()){
-        addrs = m_transaction.get_receive_outputs();
+    if(tx.is_receive()){
+        addrs = tx.get_receive_outputs();
         ret = addrs.size() > 0 ? QString::fromStdString(addrs.at(0).first) : "";
     }
     else{
-        addrs = m_transaction.get_outputs();
-        int index_change = m_transaction.get_change_index();
-        if(index_change >= 0 && index_change < (int)m_transaction.get_outputs().size()) {
+        addrs = tx.get_outputs();
+        int index_change = tx.get_change_index();
+        if(index_change >= 0 && index_change < (int)tx.get_outputs().size()) {
             addrs.erase(addrs.begin() + index_change);
         }
         ret = addrs.size() > 1 ? "Multiple addresses" : addrs.size() > 0 ? QString::fromStdString(addrs.at(0).first) : "";
@@ -832,51 +1039,119 @@ TransactionListModel::~TransactionListModel() {m_data.clear();}
 
 int TransactionListModel::rowCount(const QModelIndex &parent) const {
     Q_UNUSED(parent);
-    return m_data.count();
+    return m_rows.count();
 }
 
 QVariant TransactionListModel::data(const QModelIndex &index, int role) const {
+    if(index.row() < 0 || index.row() >= m_rows.count()){
+        return QVariant();
+    }
+    switch (role) {
+    case transaction_destinationList_role:
+    case transaction_change_role:
+    case transaction_singleSignersAssigned_role:
+        // Model-valued roles only exist on the full Transaction, and loading it is a
+        // libnunchuk call; the row reports them once the background fetch lands
+        if(!m_data[index.row()]){
+            prefetch(index.row());
+            return QVariant();
+        }
+        break;
+    default:
+        break;
+    }
+    if(!m_data[index.row()]){
+        return rowData(m_rows[index.row()], role);
+    }
+    Transaction *tx = m_data[index.row()].data();
     switch (role) {
     case transaction_txid_role:
-        return m_data[index.row()]->txid();
+        return tx->txid();
     case transaction_memo_role:
-        return m_data[index.row()]->memo();
+        return tx->memo();
     case transaction_status_role:
-        return m_data[index.row()]->status();
+        return tx->status();
     case transaction_fee_role:
-        return m_data[index.row()]->feeDisplay();
+        return tx->display().fee;
     case transaction_m_role:
-        return m_data[index.row()]->m();
+        return tx->m();
     case transaction_hasChange_role:
-        return m_data[index.row()]->hasChange();
+        return tx->hasChange();
     case transaction_destinationList_role:
-        return qVariantFromValue(m_data[index.row()]->destinationList());
+        return qVariantFromValue(tx->destinationList());
     case transaction_destinationDisp_role:
-        return m_data[index.row()]->destination();
+        return tx->display().destination;
     case transaction_change_role:
-        return qVariantFromValue(m_data[index.row()]->change());
+        return qVariantFromValue(tx->change());
     case transaction_singleSignersAssigned_role:
-        return qVariantFromValue(m_data[index.row()]->singleSignersAssigned());
+        return qVariantFromValue(tx->singleSignersAssigned());
     case transaction_subtotal_role:
-        return m_data[index.row()]->subtotalDisplay();
+        return tx->display().subtotal;
     case transaction_total_role:
-        return m_data[index.row()]->totalDisplay();
+        return tx->display().total;
     case transaction_numberSigned_role:
-        return m_data[index.row()]->numberSigned();
+        return tx->numberSigned();
     case transaction_blocktime_role:
-        return m_data[index.row()]->blocktimeDisplay();
+        return tx->display().blocktime;
     case transaction_height_role:
-        return m_data[index.row()]->height();
+        return tx->height();
     case transaction_isReceiveTx_role:
-        return m_data[index.row()]->isReceiveTx();
+        return tx->isReceiveTx();
     case transaction_replacedTx_role:
-        return m_data[index.row()]->get_replaced_by_txid();
+        return tx->get_replaced_by_txid();
     case transaction_subtotalCurrency_role:
-        return m_data[index.row()]->subtotalCurrency();
+        return tx->display().subtotalCurrency;
     case transaction_totalCurrency_role:
-        return m_data[index.row()]->totalCurrency();
+        return tx->display().totalCurrency;
     case transaction_isRbf_role:
-        return m_data[index.row()]->get_replace_txid() != "";
+        return tx->get_replace_txid() != "";
+    default:
+        return QVariant();
+    }
+}
+
+QVariant TransactionListModel::rowData(const TransactionRow &row, int role) const
+{
+    const bool inSats = (int)AppSetting::Unit::SATOSHI == AppSetting::instance()->unit();
+    QLocale locale(QLocale::English);
+    switch (role) {
+    case transaction_txid_role:
+        return row.txid;
+    case transaction_memo_role:
+        return row.memo;
+    case transaction_status_role:
+        return row.status;
+    case transaction_fee_role:
+        return inSats ? locale.toString(row.fee) : qUtils::QValueFromAmount(row.fee);
+    case transaction_m_role:
+        return row.m;
+    case transaction_hasChange_role:
+        return row.hasChange;
+    case transaction_destinationDisp_role:
+        return row.destination;
+    case transaction_subtotal_role:
+        return inSats ? locale.toString(row.subtotal) : qUtils::QValueFromAmount(row.subtotal);
+    case transaction_total_role:
+        return inSats ? locale.toString(row.subtotal + row.fee) : qUtils::QValueFromAmount(row.subtotal + row.fee);
+    case transaction_numberSigned_role:
+        return row.numberSigned;
+    case transaction_blocktime_role:
+        if(0 >= row.blocktime){
+            return "--/--/----";
+        }
+        return QDateTime::fromTime_t(row.blocktime).toString( "MM/dd/yyyy hh:mm AP");
+    case transaction_height_role:
+        return row.height;
+    case transaction_isReceiveTx_role:
+        return row.isReceive;
+    case transaction_replacedTx_role:
+        return row.replacedByTxid;
+    case transaction_subtotalCurrency_role:
+        return qUtils::currencyLocale(row.subtotal);
+    case transaction_totalCurrency_role:
+        return qUtils::currencyLocale(row.subtotal + row.fee);
+    case transaction_isRbf_role:
+        return row.isRbf;
     default:
         return QVariant();
     }
@@ -909,20 +1184,20 @@ QHash<int, QByteArray> TransactionListModel::roleNames() const {
 
 QTransactionPtr TransactionListModel::getTransactionByIndex(const int index)
 {
-    if(index < 0 || index >= m_data.count()){
+    if(index < 0 || index >= m_rows.count()){
         DBG_INFO << "Index out of range";
         return NULL;
     }
     else {
-        return m_data.at(index);
+        return materialize(index);
     }
 }
 
 QTransactionPtr TransactionListModel::getTransactionByTxid(const QString &txid)
 {
-    foreach (QTransactionPtr i , m_data ){
-        if(txid == i.data()->txid()){
-            return i;
+    for (int i = 0; i < m_rows.count(); i++) {
+        if(txid == m_rows.at(i).txid){
+            return materialize(i);
         }
     }
     return NULL;
@@ -931,16 +1206,25 @@ QTransactionPtr TransactionListModel::getTransactionByTxid(const QString &txid)
 void TransactionListModel::addTransaction(const QTransactionPtr &d){
     if(d){
         if(!contains(d.data()->txid())){
-            m_data.append(d);
+            if(m_walletId.isEmpty()){
+                m_walletId = d.data()->walletId();
+            }
+            insertRow(m_rows.count(), d.data()->snapshotRow(), d);
         }
     }
 }
 
 void TransactionListModel::updateTransactionMemo(const QString &tx_id, const QString &memo)
 {
-    for (int i = 0; i < m_data.count(); i++) {
-        if(m_data.at(i) && qUtils::strCompare(tx_id, m_data.at(i).data()->txid())){
-            m_data.at(i)->setMemo(memo);
+    for (int i = 0; i < m_rows.count(); i++) {
+        if(qUtils::strCompare(tx_id, m_rows.at(i).txid)){
+            if(m_data.at(i)){
+                m_data.at(i)->setMemo(memo);
+            }
+            else if(!qUtils::strCompare(memo, m_rows.at(i).memo)){
+                bridge::nunchukUpdateTransactionMemo(m_walletId, m_rows.at(i).txid, memo);
+            }
+            m_rows[i].memo = memo;
             emit dataChanged(index(i),index(i));
         }
     }
@@ -950,9 +1234,15 @@ void TransactionListModel::updateTransaction(const QString &tx_id, const QTransa
 {
     if(tx){
         bool existed = false;
-        for (int i = 0; i < m_data.count(); i++) {
-            if(m_data.at(i) && qUtils::strCompare(tx_id, m_data.at(i).data()->txid())){
-                m_data.at(i)->setNunchukTransaction(tx.data()->nunchukTransaction());
+        for (int i = 0; i < m_rows.count(); i++) {
+            if(qUtils::strCompare(tx_id, m_rows.at(i).txid)){
+                if(m_data.at(i)){
+                    m_data.at(i)->setNunchukTransaction(tx.data()->nunchukTransaction());
+                }
+                else {
+                    m_data[i] = tx;
+                }
+                m_rows[i] = tx.data()->snapshotRow();
                 emit dataChanged(index(i),index(i));
                 existed = true;
                 break;
@@ -960,7 +1250,7 @@ void TransactionListModel::updateTransaction(const QString &tx_id, const QTransa
         }
         if(!existed){
             beginInsertRows(QModelIndex(), rowCount(), rowCount());
-            m_data.append(tx);
+            insertRow(m_rows.count(), tx.data()->snapshotRow(), tx);
             endInsertRows();
             emit countChanged();
         }
@@ -969,24 +1259,74 @@ void TransactionListModel::updateTransaction(const QString &tx_id, const QTransa
 
 void TransactionListModel::updateTransaction(const QString &wallet_id, std::vector<nunchuk::Transaction> txs)
 {
-    beginResetModel();
-    m_data.clear();
-    for (auto it = txs.begin(); it != txs.end(); ++it) {
-        const nunchuk::Transaction &element = *it;
-        QTransactionPtr tx = bridge::convertTransaction(element, wallet_id);
-        m_data.append(tx);
+    m_walletId = wallet_id;
+    // Only the list fields are kept per row; Transaction objects are built on demand
+    QVector<TransactionRow> incoming;
+    QHash<QString, int> sources;
+    incoming.reserve(static_cast<int>(txs.size()));
+    for (int k = 0; k < (int)txs.size(); k++) {
+        TransactionRow row = Transaction::rowOf(txs.at(k));
+        if(!sources.contains(row.txid)){
+            sources.insert(row.txid, k);
+            incoming.append(row);
+        }
+    }
+    sortRows(incoming, m_sortRole, m_sortOrder);
+
+    // Reconcile against what is on screen (live rows or a restored snapshot) so
+    // unchanged rows keep their delegates instead of the whole list being rebuilt
+    const int oldCount = m_rows.count();
+    for (int i = m_rows.count() - 1; i >= 0; i--) {
+        if(!sources.contains(m_rows.at(i).txid)){
+            beginRemoveRows(QModelIndex(), i, i);
+            removeRow(i);
+            endRemoveRows();
+        }
+    }
+    for (int i = 0; i < incoming.count(); i++) {
+        const QString txid = incoming.at(i).txid;
+        int found = -1;
+        for (int j = i; j < m_rows.count(); j++) {
+            if(m_rows.at(j).txid == txid){
+                found = j;
+                break;
+            }
+        }
+        if(found < 0){
+            beginInsertRows(QModelIndex(), i, i);
+            insertRow(i, incoming.at(i));
+            endInsertRows();
+            continue;
+        }
+        if(found != i){
+            beginMoveRows(QModelIndex(), found, found, QModelIndex(), i);
+            moveRow(found, i);
+            endMoveRows();
+        }
+        const bool changed = m_rows.at(i) != incoming.at(i);
+        m_rows[i] = incoming.at(i);
+        if(m_data.at(i)){
+            m_data.at(i)->setNunchukTransaction(txs.at(sources.value(txid)));
+        }
+        if(changed){
+            emit dataChanged(index(i), index(i));
+        }
+    }
+    m_restored = false;
+    m_liveLoaded = true;
+    m_generation++;
+    if(oldCount != m_rows.count()){
+        emit countChanged();
     }
-    endResetModel();
-    emit countChanged();
 }
 
 void TransactionListModel::removeTransaction(const QString &tx_id)
 {
-    foreach (QTransactionPtr it, m_data) {
-        if(it.data() && it.data()->txid() == tx_id){
-            beginResetModel();
-            m_data.removeAll(it);
-            endResetModel();
+    for (int i = 0; i < m_rows.count(); i++) {
+        if(m_rows.at(i).txid == tx_id){
+            beginRemoveRows(QModelIndex(), i, i);
+            removeRow(i);
+            endRemoveRows();
             emit countChanged();
             break;
         }
@@ -995,38 +1335,185 @@ void TransactionListModel::removeTransaction(const QString &tx_id)
 
 bool TransactionListModel::contains(const QString &tx_id)
 {
-    foreach (QTransactionPtr i , m_data ){
-        if(0 == QString::compare(tx_id, i.data()->txid(), Qt::CaseInsensitive)){
+    for (int i = 0; i < m_rows.count(); i++) {
+        if(0 == QString::compare(tx_id, m_rows.at(i).txid, Qt::CaseInsensitive)){
             return true;
         }
     }
     return false;
 }
 
-void TransactionListModel::requestSort(int role, int order)
+void TransactionListModel::loadSnapshot(const QString &wallet_id)
 {
-    beginResetModel();
-    if(m_data.count() > 1){
+    // Reading and decompressing a large history is too slow for the GUI thread
+    if(m_liveLoaded || (!m_walletId.isEmpty() && m_walletId != wallet_id)){
+        return;
+    }
+    QPointer<TransactionListModel> self(this);
+    const quint64 generation = m_generation;
+    QtConcurrent::run([self, wallet_id, generation]() {
+        QVector<TransactionRow> rows;
+        if(!TransactionSnapshot::load(wallet_id, rows)){
+            return;
+        }
+        QMetaObject::invokeMethod(qApp, [self, wallet_id, generation, rows]() {
+            // The live history (possibly empty) may have arrived first, the model may
+            // have been reset, or it may hold another wallet now
+            if(!self || self->m_liveLoaded || self->m_generation != generation
+                    || (!self->m_walletId.isEmpty() && self->m_walletId != wallet_id)
+                    || !self->m_rows.isEmpty()){
+                return;
+            }
+            self->beginResetModel();
+            self->m_walletId = wallet_id;
+            self->m_rows = rows;
+            self->m_data.clear();
+            for (int i = 0; i < self->m_rows.count(); i++) {
+                self->m_data.append(QTransactionPtr());
+            }
+            self->m_restored = true;
+            self->m_savedRows = rows;
+            self->m_savedWalletId = wallet_id;
+            self->endResetModel();
+            emit self->countChanged();
+        }, Qt::QueuedConnection);
+    });
+}
+
+void TransactionListModel::saveSnapshot(const QString &wallet_id)
+{
+    // Only persist once the live history has fully replaced the restored rows
+    if(m_restored){
+        return;
+    }
+    syncRows();
+    if(m_savedWalletId == wallet_id && m_savedRows == m_rows){
+        return;
+    }
+    m_savedRows = m_rows;
+    m_savedWalletId = wallet_id;
+    TransactionSnapshot::save(wallet_id, m_rows);
+}
+
+QTransactionPtr TransactionListModel::materialize(int row) const
+{
+    if(!m_data.at(row) && !m_walletId.isEmpty()){
+        m_data[row] = bridge::nunchukGetTransaction(m_walletId, m_rows.at(row).txid);
+    }
+    return m_data.at(row);
+}
+
+void TransactionListModel::prefetch(int row) const
+{
+    const QString &txid = m_rows.at(row).txid;
+    if(m_walletId.isEmpty() || m_prefetching.contains(txid)){
+        return;
+    }
+    m_prefetching.insert(txid);
+    m_prefetchPending.append(txid);
+    if(m_prefetchPending.size() > 1){
+        return;
+    }
+    // Rows asked for while the view lays out join the same batch
+    QMetaObject::invokeMethod(const_cast<TransactionListModel*>(this), [this]() {
+        fetchPending();
+    }, Qt::QueuedConnection);
+}
+
+void TransactionListModel::fetchPending() const
+{
+    QStringList txids = m_prefetchPending;
+    m_prefetchPending.clear();
+    if(txids.isEmpty()){
+        return;
+    }
+    QString wallet_id = m_walletId;
+    QPointer<TransactionListModel> self(const_cast<TransactionListModel*>(this));
+    QtConcurrent::run([self, wallet_id, txids]() {
+        QHash<QString, nunchuk::Transaction> found;
+        for (const QString &txid : txids) {
+            QWarningMessage msg;
+            nunchuk::Transaction tx = bridge::nunchukGetOriginTransaction(wallet_id, txid, msg);
+            if((int)EWARNING::WarningType::NONE_MSG == msg.type()){
+                found.insert(txid, tx);
+            }
+        }
+        QMetaObject::invokeMethod(qApp, [self, wallet_id, txids, found]() {
+            if(!self){
+                return;
+            }
+            for (const QString &txid : txids) {
+                self->m_prefetching.remove(txid);
+            }
+            if(self->m_walletId != wallet_id){
+                return;
+            }
+            // Rows may have moved or been replaced while the batch was out
+            for (int i = 0; i < self->m_rows.count(); i++) {
+                auto it = found.constFind(self->m_rows.at(i).txid);
+                if(it == found.constEnd() || self->m_data.at(i)){
+                    continue;
+                }
+                self->m_data[i] = bridge::convertTransaction(it.value(), wallet_id);
+                emit self->dataChanged(self->index(i), self->index(i), {transaction_destinationList_role,
+                                                                          transaction_change_role,
+                                                                          transaction_singleSignersAssigned_role});
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+void TransactionListModel::syncRows()
+{
+    // Materialized transactions can be edited in place by the detail screens
+    for (int i = 0; i < m_data.count(); i++) {
+        if(m_data.at(i)){
+            m_rows[i] = m_data.at(i)->snapshotRow();
+        }
+    }
+}
+
+void TransactionListModel::insertRow(int row, const TransactionRow &data, const QTransactionPtr &tx)
+{
+    m_rows.insert(row, data);
+    m_data.insert(row, tx);
+}
+
+void TransactionListModel::removeRow(int row)
+{
+    m_rows.remove(row);
+    m_data.removeAt(row);
+}
+
+void TransactionListModel::moveRow(int from, int to)
+{
+    m_rows.move(from, to);
+    m_data.move(from, to);
+}
+
+void TransactionListModel::sortRows(QVector<TransactionRow> &rows, int role, int order) const
+{
+    if(rows.count() > 1){
         switch (role) {
         case transaction_txid_role:
             break;
         case transaction_memo_role:
         {
             if(Qt::DescendingOrder == order){
-                qSort(m_data.begin(), m_data.end(), sortTXsByMemoDescending);
+                qSort(rows.begin(), rows.end(), sortTXsByMemoDescending);
             }
             else{
-                qSort(m_data.begin(), m_data.end(), sortTXsByMemoAscending);
+                qSort(rows.begin(), rows.end(), sortTXsByMemoAscending);
             }
         }
             break;
         case transaction_status_role:
         {
             if(Qt::DescendingOrder == order){
-                qSort(m_data.begin(), m_data.end(), sortTXsByStatusDescending);
+                qSort(rows.begin(), rows.end(), sortTXsByStatusDescending);
             }
             else{
-                qSort(m_data.begin(), m_data.end(), sortTXsByStatusAscending);
+                qSort(rows.begin(), rows.end(), sortTXsByStatusAscending);
             }
         }
             break;
@@ -1034,48 +1521,79 @@ void TransactionListModel::requestSort(int role, int order)
         case transaction_total_role:
         {
             if(Qt::DescendingOrder == order){
-                qSort(m_data.begin(), m_data.end(), sortTXsByAmountDescending);
+                qSort(rows.begin(), rows.end(), sortTXsByAmountDescending);
             }
             else{
-                qSort(m_data.begin(), m_data.end(), sortTXsByAmountAscending);
+                qSort(rows.begin(), rows.end(), sortTXsByAmountAscending);
             }
         }
             break;
         case transaction_blocktime_role:
         {
             if(Qt::DescendingOrder == order){
-                qSort(m_data.begin(), m_data.end(), sortTXsByBlocktimeDescending);
+                qSort(rows.begin(), rows.end(), sortTXsByBlocktimeDescending);
             }
             else{
-                qSort(m_data.begin(), m_data.end(), sortTXsByBlocktimeAscending);
+                qSort(rows.begin(), rows.end(), sortTXsByBlocktimeAscending);
             }
-            linkingReplacedTransactions();
+            linkingReplacedTransactions(rows);
         }
             break;
         default:
             break;
         }
     }
-    endResetModel();
+}
+
+void TransactionListModel::requestSort(int role, int order)
+{
+    m_sortRole = role;
+    m_sortOrder = order;
+    if(m_rows.count() <= 1){
+        return;
+    }
+    syncRows();
+    QVector<TransactionRow> sorted = m_rows;
+    sortRows(sorted, role, order);
+    if(sorted == m_rows){
+        return;
+    }
+    QHash<QString, int> oldRows;
+    for (int i = 0; i < m_rows.count(); i++) {
+        oldRows.insert(m_rows.at(i).txid, i);
+    }
+    QList<QTransactionPtr> data;
+    QVector<int> newRows(m_rows.count());
+    for (int i = 0; i < sorted.count(); i++) {
+        const int from = oldRows.value(sorted.at(i).txid);
+        data.append(m_data.at(from));
+        newRows[from] = i;
+    }
+    emit layoutAboutToBeChanged();
+    const QModelIndexList oldPersistent = persistentIndexList();
+    QModelIndexList newPersistent;
+    for (const QModelIndex &idx : oldPersistent) {
+        newPersistent << index(newRows.value(idx.row(), idx.row()));
+    }
+    m_rows = sorted;
+    m_data = data;
+    changePersistentIndexList(oldPersistent, newPersistent);
+    emit layoutChanged();
 }
 
 void TransactionListModel::notifyUnitChanged()
 {
-    const QVector<int>& roles = {};
-    for (int i = 0; i < m_data.count(); i++) {
-        if(m_data.at(i).data()){
-            const auto idx = index(i);
-            emit dataChanged(idx, idx, roles);
-        }
+    if(m_rows.count() > 0){
+        emit dataChanged(index(0), index(m_rows.count() - 1));
     }
 }
 
-void TransactionListModel::linkingReplacedTransactions()
+void TransactionListModel::linkingReplacedTransactions(QVector<TransactionRow> &rows) const
 {
     QMap<QString, QString> replaces;
-    for (int i = 0; i < m_data.count(); i++) {
-        if(m_data.at(i) && (int)nunchuk::TransactionStatus::REPLACED == m_data.at(i).data()->status()){
-            replaces[m_data.at(i).data()->txid()] = m_data.at(i).data()->get_replaced_by_txid();
+    for (int i = 0; i < rows.count(); i++) {
+        if((int)nunchuk::TransactionStatus::REPLACED == rows.at(i).status){
+            replaces[rows.at(i).txid] = rows.at(i).replacedByTxid;
         }
     }
 
@@ -1084,19 +1602,17 @@ void TransactionListModel::linkingReplacedTransactions()
     for (int j = 0; j < replaces.keys().count(); j++) {
         from_index = -1;
         to_index = -1;
-        for (int k = 0; k < m_data.count(); k++) {
-            if(m_data.at(k)){
-                if(m_data.at(k).data()->txid() == replaces.keys()[j]){ // old tx replaced
-                    from_index = k;
-                }
-                if(m_data.at(k).data()->txid() == replaces[replaces.keys()[j]]){ // Find new tx
-                    to_index = k;
-                }
+        for (int k = 0; k < rows.count(); k++) {
+            if(rows.at(k).txid == replaces.keys()[j]){ // old tx replaced
+                from_index = k;
+            }
+            if(rows.at(k).txid == replaces[replaces.keys()[j]]){ // Find new tx
+                to_index = k;
             }
         }
 
         if((-1 != from_index) && (-1 != to_index) && (to_index != from_index)){
-            m_data.move(from_index, to_index);
+            rows.move(from_index, to_index);
         }
     }
 }
@@ -1104,78 +1620,87 @@ void TransactionListModel::linkingReplacedTransactions()
 void TransactionListModel::cleardata()
 {
     beginResetModel();
+    m_rows.clear();
     m_data.clear();
+    m_walletId = "";
+    m_restored = false;
+    m_liveLoaded = false;
+    m_generation++;
+    m_savedRows.clear();
+    m_savedWalletId = "";
+    m_prefetching.clear();
+    m_prefetchPending.clear();
     endResetModel();
     emit countChanged();
 }
 
 int TransactionListModel::count() const
 {
-    return m_data.size();
+    return m_rows.size();
 }
 
-bool sortTXsByBlocktimeAscending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByBlocktimeAscending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    if(v1.data()->blocktime() <= 0 && v2.data()->blocktime() <= 0){
-        if(v1.data()->status() == v2.data()->status()){
-            return (v1.data()->totalSats() > v2.data()->totalSats());
+    if(v1.blocktime <= 0 && v2.blocktime <= 0){
+        if(v1.status == v2.status){
+            return ((v1.subtotal + v1.fee) > (v2.subtotal + v2.fee));
         }
-        else if(v1.data()->status() < v2.data()->status()){
+        else if(v1.status < v2.status){
             return (true);
         }
         else{
-            return v1.data()->blocktime() < v2.data()->blocktime();
+            return v1.blocktime < v2.blocktime;
         }
     }
-    else if(v1.data()->blocktime() <= 0 && v2.data()->blocktime() > 0){ return true;}
-    else if(v1.data()->blocktime() > 0 && v2.data()->blocktime() <= 0){ return false;}
-    else {return v1.data()->blocktime() < v2.data()->blocktime();}
+    else if(v1.blocktime <= 0 && v2.blocktime > 0){ return true;}
+    else if(v1.blocktime > 0 && v2.blocktime <= 0){ return false;}
+    else {return v1.blocktime < v2.blocktime;}
 }
 
-bool sortTXsByBlocktimeDescending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByBlocktimeDescending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    if(v1.data()->blocktime() <= 0 && v2.data()->blocktime() <= 0){
-        if(v1.data()->status() == v2.data()->status()){
-            return (v1.data()->totalSats() > v2.data()->totalSats());
+    if(v1.blocktime <= 0 && v2.blocktime <= 0){
+        if(v1.status == v2.status){
+            return ((v1.subtotal + v1.fee) > (v2.subtotal + v2.fee));
         }
-        else if(v1.data()->status() < v2.data()->status()){
+        else if(v1.status < v2.status){
             return (true);
         }
         else{
-            return v1.data()->blocktime() < v2.data()->blocktime();
+            return v1.blocktime < v2.blocktime;
         }
     }
-    else if(v1.data()->blocktime() <= 0 && v2.data()->blocktime() > 0){ return true;}
-    else if(v1.data()->blocktime() > 0 && v2.data()->blocktime() <= 0){ return false;}
-    else {return v1.data()->blocktime() > v2.data()->blocktime();}
+    else if(v1.blocktime <= 0 && v2.blocktime > 0){ return true;}
+    else if(v1.blocktime > 0 && v2.blocktime <= 0){ return false;}
+    else {return v1.blocktime > v2.blocktime;}
 }
 
-bool sortTXsByAmountAscending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByAmountAscending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    return ((v1.data()->subtotalBTC() + v1.data()->totalBTC()) < (v2.data()->subtotalBTC() + v2.data()->totalBTC()));
+    return ((qUtils::QValueFromAmount(v1.subtotal) + qUtils::QValueFromAmount(v1.subtotal + v1.fee)) < (qUtils::QValueFromAmount(v2.subtotal) + qUtils::QValueFromAmount(v2.subtotal + v2.fee)));
 }
 
-bool sortTXsByAmountDescending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByAmountDescending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    return ((v1.data()->subtotalBTC() + v1.data()->totalBTC()) > (v2.data()->subtotalBTC() + v2.data()->totalBTC()));
+    return ((qUtils::QValueFromAmount(v1.subtotal) + qUtils::QValueFromAmount(v1.subtotal + v1.fee)) > (qUtils::QValueFromAmount(v2.subtotal) + qUtils::QValueFromAmount(v2.subtotal + v2.fee)));
 }
 
-bool sortTXsByMemoAscending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByMemoAscending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    return (QString::compare((v1.data()->memo()), (v2.data()->memo())) < 0);
+    return (QString::compare(v1.memo, v2.memo) < 0);
 }
 
-bool sortTXsByMemoDescending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByMemoDescending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    return (QString::compare((v1.data()->memo()), (v2.data()->memo())) > 0);
+    return (QString::compare(v1.memo, v2.memo) > 0);
 }
 
-bool sortTXsByStatusAscending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByStatusAscending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    return ((v1.data()->status()) < (v2.data()->status()));
+    return (v1.status < v2.status);
 }
 
-bool sortTXsByStatusDescending(const QTransactionPtr &v1, const QTransactionPtr &v2)
+bool sortTXsByStatusDescending(const TransactionRow &v1, const TransactionRow &v2)
 {
-    return ((v1.data()->status()) > (v2.data()->status()));
+    return (v1.status > v2.status);
 }
@@ -24,6 +24,7 @@
 #include <QObject>
 #include <QAbstractListModel>
 #include "SingleSignerModel.h"
+#include "TransactionSnapshot.h"
 #include "QOutlog.h"
 #include <nunchuk.h>
 #include <QTimer>
@@ -37,9 +38,10 @@ class Destination : public QObject {
     Q_PROPERTY(QString amount           READ amountDisplay  NOTIFY amountChanged)
     Q_PROPERTY(QString amountBTC        READ amountBTC      NOTIFY amountChanged)
     Q_PROPERTY(QString amountCurrency   READ amountCurrency NOTIFY amountChanged)
+    Q_PROPERTY(bool    isMine           READ isMine         NOTIFY isMineChanged)
 public:
     Destination();
-    Destination(const QString &address, const qint64 amount);
+    Destination(const QString &address, const qint64 amount, bool isMine = false);
     ~Destination();
     QString amountDisplay() const;
     QString amountBTC() const;
@@ -49,13 +51,24 @@ public:
 
     QString address() const;
     void setAddress(const QString & value);
+    bool isMine() const;
+    void setIsMine(bool value);
 private:
+    // Formatted amounts, recomputed when the unit or the exchange rate moves
+    void updateDisplay() const;
     QString address_;
     qint64 amount_;
+    bool isMine_ {false};
+    mutable int     displayUnit_ {-1};
+    mutable double  displayRate_ {0};
+    mutable QString amountDisplay_;
+    mutable QString amountBTC_;
+    mutable QString amountCurrency_;
 
 signals:
     void addressChanged();
     void amountChanged();
+    void isMineChanged();
 };
 typedef OurSharedPointer<Destination> QDestinationPtr;
 
@@ -70,6 +83,12 @@ public:
     QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
     QHash<int,QByteArray> roleNames() const;
     void addDestination(const QString& address, const qint64 amount);
+    struct Output {
+        QString address;
+        qint64  amount {0};
+        bool    isMine {false};
+    };
+    void updateDestinations(const QList<Output> &outputs);
     bool contains(const QString &address, qint64 &amount);
     qint64 getAmountByAddress(const QString &address);
     QMap<QString, qint64> getOutputs() const;
@@ -78,7 +97,8 @@ public:
         destination_address_role,
         destination_amount_role,
         destination_amount_btc_role,
-        destination_amount_currency_role
+        destination_amount_currency_role,
+        destination_is_mine_role
     };
     QString reciever();
     void clearAll();
@@ -187,6 +207,8 @@ public:
     QString get_replace_txid();
 
     nunchuk::Transaction nunchukTransaction() const;
+    TransactionRow snapshotRow();
+    static TransactionRow rowOf(const nunchuk::Transaction &tx);
     void setNunchukTransaction(const nunchuk::Transaction &tx);
     QString roomId();
     void setRoomId(const QString &roomId);
@@ -200,6 +222,7 @@ public:
     void setPackageFeeRate(int satvKB);
 
     QString destination();
+    static QString destinationOf(const nunchuk::Transaction &tx);
     bool isCpfp();
     time_t scheduleTime();
 
@@ -221,6 +244,20 @@ public:
     bool enableScheduleBroadcast();
     bool enableCancelTransaction();
 
+    // Formatted values the history list shows, built once per unit and rate
+    struct Display {
+        int      unit {-1};
+        double   rate {0};
+        QString  fee;
+        QString  subtotal;
+        QString  total;
+        QString  subtotalCurrency;
+        QString  totalCurrency;
+        QString  blocktime;
+        QString  destination;
+    };
+    const Display &display();
+
 public slots:
     bool parseQRTransaction(const QStringList& qrtags);
     void copyTransactionID();
@@ -231,9 +268,18 @@ protected:
     bool ImportQRTransaction(const QStringList& qrtags);
 
 private:
+    void invalidateDisplay();
+    void updateOutputs();
+    QList<DestinationListModel::Output> destinationOutputs();
+    void resolveOwnership(const QStringList &addresses);
+    Display                     m_display;
+    bool                        m_outputsDirty {true};
+    bool                        m_outputsShown {false};
     QDestinationListModelPtr    m_destinations;
     QSingleSignerListModelPtr   m_signers;
     QDestinationPtr             m_change;
+    QHash<QString, bool>        m_mineAddresses;
+    bool                        m_resolvingOwnership {false};
 
     nunchuk::Transaction        m_transaction;
     QString                     m_walletId;
@@ -301,10 +347,12 @@ public:
     void updateTransaction(const QString &wallet_id, std::vector<nunchuk::Transaction> txs);
     void removeTransaction(const QString &tx_id);
     void notifyUnitChanged();
-    void linkingReplacedTransactions();
+    void linkingReplacedTransactions(QVector<TransactionRow> &rows) const;
     void cleardata();
     int  count() const;
     bool contains(const QString &tx_id);
+    void loadSnapshot(const QString &wallet_id);
+    void saveSnapshot(const QString &wallet_id);
 
     enum TransactionRoles {
         transaction_txid_role,
@@ -333,25 +381,50 @@ signals:
     void countChanged();
 
 private:
-    QList<QTransactionPtr> m_data;
+    QVariant rowData(const TransactionRow &row, int role) const;
+    QTransactionPtr materialize(int row) const;
+    void     prefetch(int row) const;
+    void     fetchPending() const;
+    void     syncRows();
+    void     sortRows(QVector<TransactionRow> &rows, int role, int order) const;
+    void     insertRow(int row, const TransactionRow &data, const QTransactionPtr &tx = QTransactionPtr());
+    void     removeRow(int row);
+    void     moveRow(int from, int to);
+    // Every row is a compact TransactionRow; m_data holds the full Transaction at the
+    // same row only once a detail screen (or a model-valued role) has asked for it
+    QVector<TransactionRow> m_rows;
+    mutable QList<QTransactionPtr> m_data;
+    QString m_walletId {};
+    bool m_restored {false};
+    // Set once live history has been applied (even an empty one); m_generation moves on
+    // every live load and reset, so a snapshot read that started earlier is dropped
+    bool m_liveLoaded {false};
+    quint64 m_generation {0};
+    // Rows as last written to (or read from) the snapshot, so unchanged refreshes skip the write
+    QVector<TransactionRow> m_savedRows;
+    QString m_savedWalletId {};
+    // Rows data() asked to materialize; fetched in one batch on the thread pool
+    mutable QSet<QString> m_prefetching;
+    mutable QStringList m_prefetchPending;
+    int m_sortRole {-1};
+    int m_sortOrder {Qt::DescendingOrder};
 };
 typedef OurSharedPointer<TransactionListModel> QTransactionListModelPtr;
 
 // Sort Block time
-bool sortTXsByBlocktimeAscending(const QTransactionPtr &v1, const QTransactionPtr &v2);
-bool sortTXsByBlocktimeDescending(const QTransactionPtr &v1, const QTransactionPtr &v2);
-bool sortTXsByBlocktimeDescendingSkipZero(const QTransactionPtr &v1, const QTransactionPtr &v2);
+bool sortTXsByBlocktimeAscending(const TransactionRow &v1, const TransactionRow &v2);
+bool sortTXsByBlocktimeDescending(const TransactionRow &v1, const TransactionRow &v2);
 
 // Sort Amount
-bool sortTXsByAmountAscending(const QTransactionPtr &v1, const QTransactionPtr &v2);
-bool sortTXsByAmountDescending(const QTransactionPtr &v1, const QTransactionPtr &v2);
+bool sortTXsByAmountAscending(const TransactionRow &v1, const TransactionRow &v2);
+bool sortTXsByAmountDescending(const TransactionRow &v1, const TransactionRow &v2);
 
 // Sort Memo
-bool sortTXsByMemoAscending(const QTransactionPtr &v1, const QTransactionPtr &v2);
-bool sortTXsByMemoDescending(const QTransactionPtr &v1, const QTransactionPtr &v2);
+bool sortTXsByMemoAscending(const TransactionRow &v1, const TransactionRow &v2);
+bool sortTXsByMemoDescending(const TransactionRow &v1, const TransactionRow &v2);
 
 // Sort Status
-bool sortTXsByStatusAscending(const QTransactionPtr &v1, const QTransactionPtr &v2);
-bool sortTXsByStatusDescending(const QTransactionPtr &v1, const QTransactionPtr &v2);
+bool sortTXsByStatusAscending(const TransactionRow &v1, const TransactionRow &v2);
+bool sortTXsByStatusDescending(const TransactionRow &v1, const TransactionRow &v2);
 
 #endif // TRANSACTIONLISTMODEL_H
@@ -0,0 +1,150 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+#include "TransactionSnapshot.h"
+#include "AppSetting.h"
+#include "qUtils.h"
+#include "QOutlog.h"
+#include <QCryptographicHash>
+#include <QSaveFile>
+#include <QFile>
+#include <QDir>
+#include <QFileInfo>
+#include <QtConcurrent>
+
+bool TransactionRow::operator==(const TransactionRow &other) const
+{
+    return txid == other.txid
+           && memo == other.memo
+           && destination == other.destination
+           && replacedByTxid == other.replacedByTxid
+           && fee == other.fee
+           && subtotal == other.subtotal
+           && blocktime == other.blocktime
+           && status == other.status
+           && m == other.m
+           && height == other.height
+           && numberSigned == other.numberSigned
+           && hasChange == other.hasChange
+           && isReceive == other.isReceive
+           && isRbf == other.isRbf;
+}
+
+QDataStream &operator<<(QDataStream &out, const TransactionRow &row)
+{
+    out << row.txid << row.memo << row.destination << row.replacedByTxid
+        << row.fee << row.subtotal << row.blocktime
+        << qint32(row.status) << qint32(row.m) << qint32(row.height) << qint32(row.numberSigned)
+        << row.hasChange << row.isReceive << row.isRbf;
+    return out;
+}
+
+QDataStream &operator>>(QDataStream &in, TransactionRow &row)
+{
+    qint32 status = 0, m = 0, height = 0, numberSigned = 0;
+    in >> row.txid >> row.memo >> row.destination >> row.replacedByTxid
+       >> row.fee >> row.subtotal >> row.blocktime
+       >> status >> m >> height >> numberSigned
+       >> row.hasChange >> row.isReceive >> row.isRbf;
+    row.status = status;
+    row.m = m;
+    row.height = height;
+    row.numberSigned = numberSigned;
+    return in;
+}
+
+bool TransactionSnapshot::load(const QString &wallet_id, QVector<TransactionRow> &rows)
+{
+    QFunctionTime f(__PRETTY_FUNCTION__);
+    if(!AppSetting::instance()->sensitiveCacheAllowed()){
+        return false;
+    }
+    QFile file(filePath(wallet_id));
+    if(!file.exists() || !file.open(QIODevice::ReadOnly)){
+        return false;
+    }
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_12);
+    quint32 magic = 0;
+    quint16 version = 0;
+    QByteArray payload;
+    QByteArray checksum;
+    in >> magic >> version >> payload >> checksum;
+    file.close();
+    if(magic != MAGIC || version != VERSION){
+        DBG_INFO << "Snapshot version mismatch" << wallet_id << version;
+        remove(wallet_id);
+        return false;
+    }
+    if(in.status() != QDataStream::Ok || !qUtils::verifyCheckSum(payload, checksum)){
+        DBG_INFO << "Snapshot corrupted" << wallet_id;
+        remove(wallet_id);
+        return false;
+    }
+    QByteArray raw = qUncompress(payload);
+    QDataStream rowsIn(raw);
+    rowsIn.setVersion(QDataStream::Qt_5_12);
+    QVector<TransactionRow> loaded;
+    rowsIn >> loaded;
+    if(rowsIn.status() != QDataStream::Ok){
+        DBG_INFO << "Snapshot unreadable" << wallet_id;
+        remove(wallet_id);
+        return false;
+    }
+    rows = loaded;
+    return true;
+}
+
+void TransactionSnapshot::save(const QString &wallet_id, const QVector<TransactionRow> &rows)
+{
+    // Memos, addresses and amounts must not sit in a plain file beside an encrypted database
+    if(!AppSetting::instance()->sensitiveCacheAllowed()){
+        return;
+    }
+    QString path = filePath(wallet_id);
+    QtConcurrent::run([path, rows]() {
+        QByteArray raw;
+        QDataStream rowsOut(&raw, QIODevice::WriteOnly);
+        rowsOut.setVersion(QDataStream::Qt_5_12);
+        rowsOut << rows;
+        QByteArray payload = qCompress(raw);
+        QByteArray checksum = QCryptographicHash::hash(payload, QCryptographicHash::Sha256);
+
+        QDir().mkpath(QFileInfo(path).absolutePath());
+        QSaveFile file(path);
+        if(!file.open(QIODevice::WriteOnly)){
+            DBG_INFO << "Cannot write snapshot" << path;
+            return;
+        }
+        QDataStream out(&file);
+        out.setVersion(QDataStream::Qt_5_12);
+        out << MAGIC << VERSION << payload << checksum;
+        file.commit();
+    });
+}
+
+void TransactionSnapshot::remove(const QString &wallet_id)
+{
+    QFile::remove(filePath(wallet_id));
+}
+
+QString TransactionSnapshot::filePath(const QString &wallet_id)
+{
+    return QString("%1/snapshots/%2.txs").arg(AppSetting::instance()->cachePath()).arg(wallet_id);
+}
@@ -0,0 +1,65 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+
+#ifndef TRANSACTIONSNAPSHOT_H
+#define TRANSACTIONSNAPSHOT_H
+
+#include <QString>
+#include <QVector>
+#include <QDataStream>
+
+// Display fields of one history row, enough to draw the list before the live history is converted
+struct TransactionRow {
+    QString txid {};
+    QString memo {};
+    QString destination {};
+    QString replacedByTxid {};
+    qint64  fee {0};
+    qint64  subtotal {0};
+    qint64  blocktime {0};
+    int     status {0};
+    int     m {0};
+    int     height {0};
+    int     numberSigned {0};
+    bool    hasChange {false};
+    bool    isReceive {false};
+    bool    isRbf {false};
+
+    bool operator==(const TransactionRow &other) const;
+    bool operator!=(const TransactionRow &other) const { return !(*this == other); }
+};
+QDataStream &operator<<(QDataStream &out, const TransactionRow &row);
+QDataStream &operator>>(QDataStream &in, TransactionRow &row);
+
+// Versioned, checksummed on-disk copy of a wallet's sorted history rows
+class TransactionSnapshot
+{
+public:
+    static bool load(const QString &wallet_id, QVector<TransactionRow> &rows);
+    static void save(const QString &wallet_id, const QVector<TransactionRow> &rows);
+    static void remove(const QString &wallet_id);
+
+private:
+    static QString filePath(const QString &wallet_id);
+    static constexpr quint32 MAGIC      = 0x4E435448; // "NCTH"
+    static constexpr quint16 VERSION    = 1;
+};
+
+#endif // TRANSACTIONSNAPSHOT_H
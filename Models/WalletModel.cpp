@@ -22,6 +22,7 @@
 #include "AppSetting.h"
 #include "AppModel.h"
 #include <QQmlEngine>
+#include <QElapsedTimer>
 #include "bridgeifaces.h"
 #include "Servers/Draco.h"
 #include "Servers/Byzantine.h"
@@ -36,6 +37,9 @@
 #include "Premiums/QWalletServicesTag.h"
 #include "Premiums/QUserWallets.h"
 #include "Premiums/QGroupWallets.h"
+#include "Commons/OffsetPager.h"
+#include "Commons/FanOut.h"
+#include "Commons/PsbtImportCache.h"
 
 int Wallet::m_flow = 0;
 Wallet::Wallet() :
@@ -43,6 +47,11 @@ Wallet::Wallet() :
     m_createDate(QDateTime::currentDateTime()),
     m_signers(QSingleSignerListModelPtr(new SingleSignerListModel())),
     m_transactionHistory(QTransactionListModelPtr(new TransactionListModel())),
+    m_addressBalances(QAddressBalanceCachePtr(new AddressBalanceCache())),
+    m_usedAddressModel(QAddressListModelPtr(new AddressListModel(m_addressBalances))),
+    m_unUsedAddressModel(QAddressListModelPtr(new AddressListModel(m_addressBalances))),
+    m_usedChangeAddressModel(QAddressListModelPtr(new AddressListModel(m_addressBalances))),
+    m_unUsedChangeAddressModel(QAddressListModelPtr(new AddressListModel(m_addressBalances))),
     m_creationMode((int)CreationMode::CREATE_NEW_WALLET)
 {
     m_roomMembers.clear();
@@ -73,35 +82,31 @@ void Wallet::convert(const Wallet *w)
     }
 }
 
-void Wallet::convert(const nunchuk::Wallet &w)
+void Wallet::convert(nunchuk::Wallet w, bool fetchDashboard)
 {
-    m_wallet = w;
-    setId(QString::fromStdString(w.get_id()));
-    setM(w.get_m());
-    setN(w.get_n());
-    setName(QString::fromStdString(w.get_name()));
-    setAddressType(QString::number((int)w.get_address_type()));
-    setBalance(w.get_unconfirmed_balance());
-    setCreateDate(QDateTime::fromTime_t(w.get_create_date()));
-    setEscrow(w.is_escrow());
-    setGapLimit(w.get_gap_limit());
-    setDescription(QString::fromStdString(w.get_description()));
+    NotifyBatch<Wallet>::Scope batch(m_notify);
+    m_wallet = std::move(w);
+    setId(QString::fromStdString(m_wallet.get_id()));
+    setM(m_wallet.get_m());
+    setN(m_wallet.get_n());
+    setName(QString::fromStdString(m_wallet.get_name()));
+    setAddressType(QString::number((int)m_wallet.get_address_type()));
+    setBalance(m_wallet.get_unconfirmed_balance());
+    setCreateDate(QDateTime::fromTime_t(m_wallet.get_create_date()));
+    setEscrow(m_wallet.is_escrow());
+    setGapLimit(m_wallet.get_gap_limit());
+    setDescription(QString::fromStdString(m_wallet.get_description()));
     serverKeyPtr();
     inheritancePlanPtr();
-    QGroupDashboardPtr dash = dashboard();
-    if (dash && dash->myInfo().isEmpty()) {
-        dash->GetMemberInfo();
-        QtConcurrent::run([dash]() {
-            if (dash) {
-                dash->GetAlertsInfo();
-                dash->GetWalletInfo();
-                dash->GetHealthCheckInfo();
-            }
-        });
+    if (fetchDashboard) {
+        if (QGroupDashboardPtr dash = pendingDashboard()) {
+            dash->GetMemberInfo();
+            refreshDashboard(dash);
+        }
     }
 
     m_signers->cleardata();
-    for (nunchuk::SingleSigner signer : w.get_signers()) {
+    for (const nunchuk::SingleSigner &signer : m_wallet.get_signers()) {
         QSingleSignerPtr ret = QSingleSignerPtr(new QSingleSigner(signer));
         m_signers->addSingleSigner(ret);
     }
@@ -110,6 +115,36 @@ void Wallet::convert(const nunchuk::Wallet &w)
     }
 }
 
+void Wallet::beginUpdate()
+{
+    m_notify.begin();
+}
+
+void Wallet::endUpdate()
+{
+    m_notify.end();
+}
+
+QGroupDashboardPtr Wallet::pendingDashboard() const
+{
+    QGroupDashboardPtr dash = dashboard();
+    if (dash && dash->myInfo().isEmpty()) {
+        return dash;
+    }
+    return {};
+}
+
+void Wallet::refreshDashboard(const QGroupDashboardPtr &dash)
+{
+    QtConcurrent::run([dash]() {
+        if (dash) {
+            dash->GetAlertsInfo();
+            dash->GetWalletInfo();
+            dash->GetHealthCheckInfo();
+        }
+    });
+}
+
 QString Wallet::id() const {return m_id;}
 
 int Wallet::m() const { return m_m;}
@@ -177,63 +212,65 @@ void Wallet::setId(const QString &d)
 {
     if(d != m_id){
         m_id = d;
-        emit idChanged();
+        m_addressBalances->setWalletId(d);
+        m_notify.notify(&Wallet::idChanged);
     }
 }
 
 void Wallet::setM(const int d) {
     if(d != m_m){
         m_m = qMax(0, d);
-        emit mChanged();
+        m_notify.notify(&Wallet::mChanged);
     }
 }
 
 void Wallet::setN(const int d) {
     if(d != n_n){
         n_n = qMax(0, d);
-        emit nChanged();
+        m_notify.notify(&Wallet::nChanged);
     }
 }
 
 void Wallet::setName(const QString &d) {
     if(d != m_name){
         m_name = d;
-        emit nameChanged();
+        m_notify.notify(&Wallet::nameChanged);
     }
 }
 
 void Wallet::setAddressType(const QString &d) {
     if(d != m_addressType){
         m_addressType = d;
-        emit addressTypeChanged();
+        m_notify.notify(&Wallet::addressTypeChanged);
     }
 }
 
 void Wallet::setBalance(const qint64 d) {
     if(d != m_balance){
         m_balance = d;
-        emit balanceChanged();
+        m_addressBalances->invalidate();
+        m_notify.notify(&Wallet::balanceChanged);
     }
 }
 
 void Wallet::setCreateDate(const QDateTime &d) {
     if(d != m_createDate){
         m_createDate = d;
-        emit createDateChanged();
+        m_notify.notify(&Wallet::createDateChanged);
     }
 }
 
 void Wallet::setEscrow(const bool d) {
     if(d != m_escrow){
         m_escrow = d;
-        emit escrowChanged();
+        m_notify.notify(&Wallet::escrowChanged);
     }
 }
 
 void Wallet::setSigners(const QSingleSignerListModelPtr &d){
     m_signers = d;
-    emit nChanged();
-    emit singleSignersAssignedChanged();
+    m_notify.notify(&Wallet::nChanged);
+    m_notify.notify(&Wallet::singleSignersAssignedChanged);
 }
 
 QString Wallet::descriptior() const
@@ -261,7 +298,7 @@ QString Wallet::address() const {
 void Wallet::setAddress(const QString &d){
     if(d != m_address){
         m_address = d;
-        emit addressChanged();
+        m_notify.notify(&Wallet::addressChanged);
     }
 }
 
@@ -272,7 +309,8 @@ QStringList Wallet::usedAddressList() const {
 void Wallet::setUsedAddressList(const QStringList &d){
     if(d != m_usedAddressList){
         m_usedAddressList = d;
-        emit usedAddressChanged();
+        m_usedAddressModel->setAddresses(d);
+        m_notify.notify(&Wallet::usedAddressChanged);
     }
 }
 
@@ -282,7 +320,8 @@ QStringList Wallet::unUsedAddressList() const {
 
 void Wallet::setunUsedAddressList(const QStringList &d){
     m_unUsedAddressList = d;
-    emit unUsedAddressChanged();
+    m_unUsedAddressModel->setAddresses(d);
+    m_notify.notify(&Wallet::unUsedAddressChanged);
     if(m_unUsedAddressList.isEmpty()){
         setAddress("There is no avaialable address");
     }
@@ -300,7 +339,7 @@ void Wallet::setCapableCreate(bool capableCreate)
 {
     if(m_capableCreate != capableCreate){
         m_capableCreate = capableCreate;
-        emit capableCreateChanged();
+        m_notify.notify(&Wallet::capableCreateChanged);
     }
 }
 
@@ -313,7 +352,7 @@ void Wallet::setDescription(const QString &description)
 {
     if(m_description != description){
         m_description = description;
-        emit descriptionChanged();
+        m_notify.notify(&Wallet::descriptionChanged);
     }
 }
 
@@ -326,7 +365,8 @@ void Wallet::setUsedChangeAddressList(const QStringList &usedChangeAddressList)
 {
     if(m_usedChangeAddressList != usedChangeAddressList){
         m_usedChangeAddressList = usedChangeAddressList;
-        emit usedChangeAddressChanged();
+        m_usedChangeAddressModel->setAddresses(usedChangeAddressList);
+        m_notify.notify(&Wallet::usedChangeAddressChanged);
     }
 }
 
@@ -339,10 +379,36 @@ void Wallet::setUnUsedChangeddAddressList(const QStringList &unUseChangeddAddres
 {
     if(m_unUsedChangedAddressList != unUseChangeddAddressList){
         m_unUsedChangedAddressList = unUseChangeddAddressList;
-        emit unUsedChangeAddressChanged();
+        m_unUsedChangeAddressModel->setAddresses(unUseChangeddAddressList);
+        m_notify.notify(&Wallet::unUsedChangeAddressChanged);
     }
 }
 
+AddressListModel *Wallet::usedAddressModel() const
+{
+    return m_usedAddressModel.data();
+}
+
+AddressListModel *Wallet::unUsedAddressModel() const
+{
+    return m_unUsedAddressModel.data();
+}
+
+AddressListModel *Wallet::usedChangeAddressModel() const
+{
+    return m_usedChangeAddressModel.data();
+}
+
+AddressListModel *Wallet::unUsedChangeAddressModel() const
+{
+    return m_unUsedChangeAddressModel.data();
+}
+
+AddressBalanceCache *Wallet::addressBalances() const
+{
+    return m_addressBalances.data();
+}
+
 TransactionListModel *Wallet::transactionHistory() const{
     return m_transactionHistory.data();
 }
@@ -368,7 +434,7 @@ void Wallet::setTransactionHistory(const QTransactionListModelPtr &d) {
     if(m_transactionHistory){
         m_transactionHistory->requestSort(TransactionListModel::TransactionRoles::transaction_blocktime_role, Qt::DescendingOrder);
     }
-    emit transactionHistoryChanged();
+    m_notify.notify(&Wallet::transactionHistoryChanged);
 }
 
 QString Wallet::unUseAddress() const
@@ -393,7 +459,7 @@ void Wallet::setIsDeleting(const bool val)
     if (m_isDeleting == val)
         return;
     m_isDeleting = val;
-    emit isDeletingChanged();
+    m_notify.notify(&Wallet::isDeletingChanged);
 }
 
 bool Wallet::needBackup() const
@@ -405,7 +471,7 @@ void Wallet::setNeedBackup(const bool bVal)
 {
     if (bVal != needBackup()) {
         m_wallet.set_need_backup(bVal);
-        emit needBackupChanged();
+        m_notify.notify(&Wallet::needBackupChanged);
     }
 }
 
@@ -436,7 +502,7 @@ void Wallet::setNShared(int d)
 {
     if(d != m_nShared){
         m_nShared = qMax(0, d);
-        emit nSharedChanged();
+        m_notify.notify(&Wallet::nSharedChanged);
     }
 }
 
@@ -449,7 +515,7 @@ void Wallet::setIsSharedWallet(bool isShared)
 {
     if(m_isSharedWallet != isShared){
         m_isSharedWallet = isShared;
-        emit isSharedWalletChanged();
+        m_notify.notify(&Wallet::isSharedWalletChanged);
     }
 }
 
@@ -462,7 +528,7 @@ void Wallet::setRoomId(const QString &roomId)
 {
     if(m_roomId != roomId){
         m_roomId = roomId;
-        emit roomIdChanged();
+        m_notify.notify(&Wallet::roomIdChanged);
     }
 }
 
@@ -475,7 +541,7 @@ void Wallet::setInitEventId(const QString &initEventId)
 {
     if(m_initEventId != initEventId){
         m_initEventId = initEventId;
-        emit initEventIdChanged();
+        m_notify.notify(&Wallet::initEventIdChanged);
     }
 }
 
@@ -501,7 +567,7 @@ void Wallet::setGapLimit(int gap_limit)
 {
     if(m_gapLimit != gap_limit){
         m_gapLimit = gap_limit;
-        emit gapLimitChanged();
+        m_notify.notify(&Wallet::gapLimitChanged);
     }
 }
 
@@ -961,34 +1027,9 @@ void Wallet::GetUserTxs()
 {
     if(isUserWallet()){
         QString wallet_id = id();
-        QJsonObject data = Draco::instance()->assistedWalletGetListTx(wallet_id);
-        QJsonArray transactions = data["transactions"].toArray();
-        for(QJsonValue js_value : transactions){
-            QJsonObject transaction = js_value.toObject();
-            QString status = transaction.value("status").toString();
-            QString psbt = transaction.value("psbt").toString();
-            QString memo = transaction.value("note").toString();;
-            QString type = transaction.value("type").toString();
-            QString transaction_id = transaction.value("transaction_id").toString();
-            if (status == "READY_TO_BROADCAST" || status == "PENDING_SIGNATURES" ) {
-                QWarningMessage _msg;
-                QTransactionPtr tran = bridge::nunchukImportPsbt(wallet_id, psbt, _msg);
-                if(tran && (int)EWARNING::WarningType::NONE_MSG == _msg.type()){
-                    if(transactionHistory() && transactionHistory()->contains(transaction_id)){
-                        transactionHistory()->updateTransactionMemo(transaction_id, memo);
-                    }
-                    else {
-                        bridge::nunchukUpdateTransactionMemo(wallet_id, transaction_id, memo);
-                    }
-                    long int broadcast_time_milis = static_cast<long int>(transaction.value("broadcast_time_milis").toDouble());
-                    // honey badger feature: schedule broadcast
-                    long int current_time_stamp_milis = static_cast<long int>(std::time(nullptr)) * 1000;
-                    if(type == "SCHEDULED" && broadcast_time_milis > current_time_stamp_milis) {
-                        bridge::nunchukUpdateTransactionSchedule(wallet_id, transaction_id, broadcast_time_milis/1000,_msg);
-                    }
-                }
-            }
-        }
+        ImportServerTxs([wallet_id](JsonArrayStream::Element onTransaction) {
+            return Draco::instance()->assistedWalletGetListTx(wallet_id, onTransaction);
+        });
         //Remove cancelled txs
         GetUserCancelledTxs();
         GetUserTxNotes();
@@ -998,26 +1039,104 @@ void Wallet::GetUserTxs()
 void Wallet::GetUserCancelledTxs()
 {
     if(isUserWallet()){
-        int offset = 0;
-        const int limit = 10;
         QString wallet_id = id();
-        while (true) {
-            QJsonObject data = Draco::instance()->assistedWalletDeleteListTx(wallet_id, offset, limit);
-            QJsonArray transactions = data.value("transactions").toArray();
-            for (QJsonValue js_value : transactions) {
-                QJsonObject transaction = js_value.toObject();
-                QString wallet_local_id = transaction.value("wallet_local_id").toString();
-                QString transaction_id = transaction.value("transaction_id").toString();
-                if(transactionHistory() && transactionHistory()->contains(transaction_id)){
-                    bridge::nunchukDeleteTransaction(wallet_local_id, transaction_id);
-                }
+        OffsetPager pager("assistedWalletDeleteListTx", [wallet_id](int offset, int limit, QJsonArray &items) {
+            QJsonObject data;
+            QString error_msg = "";
+            if (!Draco::instance()->assistedWalletDeleteListTx(wallet_id, offset, limit, data, error_msg)) {
+                return false;
             }
-            if (transactions.size() == 0 || transactions.size() < limit) {
-                return; // exit while loop
+            items = data.value("transactions").toArray();
+            return true;
+        });
+        pager.run([this](const QJsonArray &transactions) {
+            RemoveCancelledTxs(transactions);
+            return true;
+        });
+    }
+}
+
+void Wallet::RemoveCancelledTxs(const QJsonArray &transactions)
+{
+    for (QJsonValue js_value : transactions) {
+        QJsonObject transaction = js_value.toObject();
+        QString wallet_local_id = transaction.value("wallet_local_id").toString();
+        QString transaction_id = transaction.value("transaction_id").toString();
+        if(transactionHistory() && transactionHistory()->contains(transaction_id)){
+            bridge::nunchukDeleteTransaction(wallet_local_id, transaction_id);
+        }
+    }
+}
+
+bool Wallet::HasLocalTransaction(const QString &transaction_id)
+{
+    if(transactionHistory() && transactionHistory()->contains(transaction_id)){
+        return true;
+    }
+    // The loaded history may be partial or not loaded at all; ask the local database
+    QWarningMessage msg;
+    bridge::nunchukGetOriginTransaction(id(), transaction_id, msg);
+    return (int)EWARNING::WarningType::NONE_MSG == msg.type();
+}
+
+void Wallet::ImportServerTxs(const std::function<bool(JsonArrayStream::Element)> &fetch)
+{
+    QString wallet_id = id();
+    PsbtImportCache cache(wallet_id);
+    cache.load();
+    QHash<QString, QJsonObject> changed;
+    QHash<QString, QString> digests;
+    QStringList pending;
+    int skipped = 0;
+    // Transactions arrive while the list is still downloading; unchanged ones are dropped right away
+    bool ret = fetch([&](const QJsonObject &transaction) {
+        QString status = transaction.value("status").toString();
+        QString transaction_id = transaction.value("transaction_id").toString();
+        if (status == "READY_TO_BROADCAST" || status == "PENDING_SIGNATURES" ) {
+            pending.append(transaction_id);
+            QString digest = PsbtImportCache::digest(transaction);
+            // The local database may have lost the transaction even though the server copy is the same
+            if(cache.unchanged(transaction_id, digest) && HasLocalTransaction(transaction_id)){
+                skipped++;
+                return;
             }
-            offset += transactions.size();
+            changed.insert(transaction_id, transaction);
+            digests.insert(transaction_id, digest);
+        }
+    });
+    if(!ret){
+        return;
+    }
+    QStringList imported;
+    for(const QString &transaction_id : changed.keys()){
+        QWarningMessage _msg;
+        QTransactionPtr tran = bridge::nunchukImportPsbt(wallet_id, changed.value(transaction_id).value("psbt").toString(), _msg);
+        if(tran && (int)EWARNING::WarningType::NONE_MSG == _msg.type()){
+            imported.append(transaction_id);
+        }
+    }
+    for(const QString &transaction_id : imported){
+        QJsonObject transaction = changed.value(transaction_id);
+        QString memo = transaction.value("note").toString();
+        QString type = transaction.value("type").toString();
+        if(transactionHistory() && transactionHistory()->contains(transaction_id)){
+            transactionHistory()->updateTransactionMemo(transaction_id, memo);
+        }
+        else {
+            bridge::nunchukUpdateTransactionMemo(wallet_id, transaction_id, memo);
+        }
+        long int broadcast_time_milis = static_cast<long int>(transaction.value("broadcast_time_milis").toDouble());
+        // honey badger feature: schedule broadcast
+        long int current_time_stamp_milis = static_cast<long int>(std::time(nullptr)) * 1000;
+        if(type == "SCHEDULED" && broadcast_time_milis > current_time_stamp_milis) {
+            QWarningMessage _msg;
+            bridge::nunchukUpdateTransactionSchedule(wallet_id, transaction_id, broadcast_time_milis/1000, _msg);
         }
+        cache.record(transaction_id, digests.value(transaction_id));
     }
+    cache.retain(pending);
+    cache.save();
+    DBG_INFO << wallet_id << "psbt imported:" << imported.size() << "skipped:" << skipped << "failed:" << changed.size() - imported.size();
 }
 
 void Wallet::GetUserTxNotes()
@@ -1203,42 +1322,12 @@ void Wallet::UpdateUserWallet(const QString &name, const QString &description)
 void Wallet::GetGroupTxs()
 {
     if(isGroupWallet()){
-        QJsonObject output;
-        QString errormsg = "";
         QString wallet_id = id();
         QString group_id = groupId();
-        bool ret = Byzantine::instance()->GetAllTransaction(group_id, wallet_id, output, errormsg);
-        if(ret){
-            QJsonArray transactions = output["transactions"].toArray();
-            for (auto i : transactions) {
-                QJsonObject transaction = i.toObject();
-                QString status = transaction.value("status").toString();
-                QString psbt = transaction.value("psbt").toString();
-                QString memo = transaction.value("note").toString();;
-                QString type = transaction.value("type").toString();
-                QString transaction_id = transaction.value("transaction_id").toString();
-                if (status == "READY_TO_BROADCAST" || status == "PENDING_SIGNATURES" ) {
-                    QWarningMessage warningmsg;
-                    QTransactionPtr tran = bridge::nunchukImportPsbt(wallet_id, psbt, warningmsg);
-                    if(tran && (int)EWARNING::WarningType::NONE_MSG == warningmsg.type()){
-                        if(transactionHistory() && transactionHistory()->contains(transaction_id)){
-                            transactionHistory()->updateTransactionMemo(transaction_id, memo);
-                        }
-                        else {
-                            bridge::nunchukUpdateTransactionMemo(wallet_id, transaction_id, memo);
-                        }
-                        long int broadcast_time_milis = static_cast<long int>(transaction.value("broadcast_time_milis").toDouble());
-                        // honey badger feature: schedule broadcast
-                        long int current_time_stamp_milis = static_cast<long int>(std::time(nullptr)) * 1000;
-                        if(type == "SCHEDULED" && broadcast_time_milis > current_time_stamp_milis) {
-                            warningmsg.resetWarningMessage();
-                            bridge::nunchukUpdateTransactionSchedule(wallet_id, transaction_id, broadcast_time_milis/1000, warningmsg);
-                        }
-                    }
-                    warningmsg.resetWarningMessage();
-                }
-            }
-        }
+        ImportServerTxs([group_id, wallet_id](JsonArrayStream::Element onTransaction) {
+            QString errormsg = "";
+            return Byzantine::instance()->GetAllTransaction(group_id, wallet_id, onTransaction, errormsg);
+        });
         //Remove cancelled txs
         GetGroupCancelledTxs();
         GetGroupTxNotes();
@@ -1248,33 +1337,19 @@ void Wallet::GetGroupTxs()
 void Wallet::GetGroupCancelledTxs()
 {
     if(isGroupWallet()){
-        QJsonObject output;
-        QString errormsg = "";
-        int offset = 0;
-        const int limit = 10;
         QString wallet_id = id();
         QString group_id = groupId();
-        while (true) {
+        OffsetPager pager("GetAllCancelledTransaction", [group_id, wallet_id](int offset, int limit, QJsonArray &items) {
+            QJsonObject output;
+            QString errormsg = "";
             bool ret = Byzantine::instance()->GetAllCancelledTransaction(group_id, wallet_id, offset, limit, output, errormsg);
-            if(ret){
-                QJsonArray transactions = output.value("transactions").toArray();
-                for (QJsonValue js_value : transactions) {
-                    QJsonObject transaction = js_value.toObject();
-                    QString wallet_local_id = transaction.value("wallet_local_id").toString();
-                    QString transaction_id = transaction.value("transaction_id").toString();
-                    if(transactionHistory() && transactionHistory()->contains(transaction_id)){
-                        bridge::nunchukDeleteTransaction(wallet_local_id, transaction_id);
-                    }
-                }
-                if (transactions.size() == 0 || transactions.size() < limit) {
-                    return; // exit while loop
-                }
-                offset += transactions.size();
-            }
-            else{
-                return;
-            }
-        }
+            items = output.value("transactions").toArray();
+            return ret;
+        });
+        pager.run([this](const QJsonArray &transactions) {
+            RemoveCancelledTxs(transactions);
+            return true;
+        });
     }
 }
 
@@ -1897,21 +1972,64 @@ QVariant WalletListModel::get(int row)
 void WalletListModel::addWallet(const QWalletPtr &wallet)
 {
     if(wallet && !containsId(wallet.data()->id())){
-        beginResetModel();
+        beginInsertRows(QModelIndex(), d_.count(), d_.count());
+        m_indexById.insert(wallet.data()->id().toLower(), d_.count());
         d_.append(wallet);
-        endResetModel();
+        endInsertRows();
     }
 }
 
+void WalletListModel::addWallets(std::vector<nunchuk::Wallet> wallets)
+{
+    QList<QWalletPtr> added;
+    QHash<QString, QGroupDashboardPtr> dashboards;
+    QSet<QString> ids;
+    for (nunchuk::Wallet &w : wallets) {
+        QElapsedTimer timer;
+        timer.start();
+        QWalletPtr wallet = QWalletPtr(new Wallet());
+        wallet.data()->convert(std::move(w), false);
+        const QString wallet_id = wallet.data()->id();
+        if(containsId(wallet_id) || ids.contains(wallet_id.toLower())){
+            continue;
+        }
+        ids.insert(wallet_id.toLower());
+        if (QGroupDashboardPtr dash = wallet.data()->pendingDashboard()) {
+            dashboards.insert(wallet_id, dash);
+        }
+        added.append(wallet);
+        DBG_INFO << wallet_id << "converted in" << timer.elapsed() << "ms";
+    }
+    if(!added.isEmpty()){
+        beginInsertRows(QModelIndex(), d_.count(), d_.count() + added.count() - 1);
+        for (const QWalletPtr &wallet : added) {
+            m_indexById.insert(wallet.data()->id().toLower(), d_.count());
+            d_.append(wallet);
+        }
+        endInsertRows();
+    }
+    if(dashboards.isEmpty()){
+        return;
+    }
+    // Each group wallet needs a member info round trip; run them side by side off the
+    // GUI thread so the rows show up right away and the dashboards fill in behind them
+    QtConcurrent::run([dashboards]() {
+        FanOut::run("wallet-dashboards", dashboards.keys(), [dashboards](const QString &wallet_id) {
+            dashboards.value(wallet_id)->GetMemberInfo();
+        });
+        for (const QGroupDashboardPtr &dash : dashboards) {
+            Wallet::refreshDashboard(dash);
+        }
+    });
+}
+
 void WalletListModel::replaceWallet(const QWalletPtr &wallet)
 {
     if(wallet){
-        for(int i = 0; i < d_.count(); i++){
-            if(0 == QString::compare(wallet.data()->id(), d_.at(i)->id(), Qt::CaseInsensitive)){
-                d_.replace(i, wallet);
-                emit dataChanged(index(i),index(i));
-                break;
-            }
+        int i = indexOfId(wallet.data()->id());
+        if(i >= 0){
+            d_.replace(i, wallet);
+            emit dataChanged(index(i),index(i));
         }
     }
 }
@@ -1919,53 +2037,47 @@ void WalletListModel::replaceWallet(const QWalletPtr &wallet)
 void WalletListModel::addSharedWallet(const QWalletPtr &wallet)
 {
     if(wallet){
-        beginResetModel();
         if(containsId(wallet.data()->id())){
             replaceWallet(wallet);
         }
         else{
             addWallet(wallet);
         }
-        endResetModel();
     }
 }
 
 void WalletListModel::updateBalance(const QString &walletId, const qint64 balance)
 {
-    for (int i = 0; i < d_.count(); i++) {
-        if(d_.at(i).data() && 0 == QString::compare(walletId, d_.at(i)->id(), Qt::CaseInsensitive)){
-            d_.at(i)->setBalance(balance);
-            emit dataChanged(index(i),index(i));
-        }
+    int i = indexOfId(walletId);
+    if(i >= 0 && d_.at(i).data()){
+        d_.at(i)->setBalance(balance);
+        emit dataChanged(index(i),index(i), {wallet_Balance_Role, wallet_BalanceBTC_Role, wallet_BalanceCurrency_Role});
     }
 }
 
 void WalletListModel::updateName(const QString &walletId, const QString &value)
 {
-    for (int i = 0; i < d_.count(); i++) {
-        if(d_.at(i).data() && 0 == QString::compare(walletId, d_.at(i)->id(), Qt::CaseInsensitive)){
-            d_.at(i)->setName(value);
-            emit dataChanged(index(i),index(i));
-        }
+    int i = indexOfId(walletId);
+    if(i >= 0 && d_.at(i).data()){
+        d_.at(i)->setName(value);
+        emit dataChanged(index(i),index(i), {wallet_Name_Role});
     }
 }
 
 void WalletListModel::dataUpdated(const QString &walletId)
 {
-    for (int i = 0; i < d_.count(); i++) {
-        if(d_.at(i).data() && 0 == QString::compare(walletId, d_.at(i)->id(), Qt::CaseInsensitive)){
-            emit dataChanged(index(i),index(i));
-        }
+    int i = indexOfId(walletId);
+    if(i >= 0 && d_.at(i).data()){
+        emit dataChanged(index(i),index(i));
     }
 }
 
 void WalletListModel::updateDescription(const QString &walletId, const QString &value)
 {
-    for (int i = 0; i < d_.count(); i++) {
-        if(d_.at(i).data() && 0 == QString::compare(walletId, d_.at(i)->id(), Qt::CaseInsensitive)){
-            d_.at(i)->setDescription(value);
-            emit dataChanged(index(i),index(i));
-        }
+    int i = indexOfId(walletId);
+    if(i >= 0 && d_.at(i).data()){
+        d_.at(i)->setDescription(value);
+        emit dataChanged(index(i),index(i));
     }
 }
 
@@ -2017,32 +2129,35 @@ QWalletPtr WalletListModel::getWalletByIndex(const int index)
 
 QWalletPtr WalletListModel::getWalletById(const QString &walletId)
 {
-    foreach (QWalletPtr it, d_) {
-        if(0 == QString::compare(walletId, it.data()->id(), Qt::CaseInsensitive)){
-            return it;
-        }
+    int i = indexOfId(walletId);
+    if(i >= 0){
+        return d_.at(i);
     }
     return QWalletPtr(NULL);
 }
 
 bool WalletListModel::removeWallet(const QWalletPtr it)
 {
-    beginResetModel();
-    d_.removeAll(it);
-    endResetModel();
+    for (int i = d_.count() - 1; i >= 0; i--) {
+        if(d_.at(i) == it){
+            beginRemoveRows(QModelIndex(), i, i);
+            d_.removeAt(i);
+            endRemoveRows();
+        }
+    }
+    rebuildIndex();
     return true;
 }
 
 void WalletListModel::removeWallet(const QString &walletId)
 {
-    beginResetModel();
-    foreach (QWalletPtr it, d_) {
-        if(0 == QString::compare(walletId, it.data()->id(), Qt::CaseInsensitive)){
-            d_.removeOne(it);
-            break;
-        }
+    int i = indexOfId(walletId);
+    if(i >= 0){
+        beginRemoveRows(QModelIndex(), i, i);
+        d_.removeAt(i);
+        endRemoveRows();
+        rebuildIndex();
     }
-    endResetModel();
 }
 
 void WalletListModel::notifyUnitChanged()
@@ -2080,21 +2195,15 @@ void WalletListModel::notifyMasterSignerDeleted(const QString &masterSignerId)
 
 int WalletListModel::getWalletIndexById(const QString &walletId)
 {
-    for (int i = 0; i < d_.count(); i++) {
-        if(0 == QString::compare(walletId, d_.at(i).data()->id(), Qt::CaseInsensitive)){
-            return i;
-        }
-    }
-    return 0;
+    return qMax(0, indexOfId(walletId));
 }
 
 void WalletListModel::updateHealthCheckTime()
 {
-    beginResetModel();
+    // Signer lists refresh their own rows, the wallet rows themselves are unchanged
     foreach (QWalletPtr i , d_ ){
         i.data()->singleSignersAssigned()->updateHealthCheckTime();
     }
-    endResetModel();
 }
 
 void WalletListModel::refresh()
@@ -2105,59 +2214,179 @@ void WalletListModel::refresh()
 
 void WalletListModel::requestSort(int role, int order)
 {
-    beginResetModel();
-    if(d_.count() > 1){
-        switch (role) {
-        case wallet_createDate_Role:
-        {
-            if(Qt::DescendingOrder == order){
-                qSort(d_.begin(), d_.end(), sortWalletByNameDescending);
-            }
-            else{
-                qSort(d_.begin(), d_.end(), sortWalletByNameAscending);
-            }
+    m_sortRole = role;
+    m_sortOrder = order;
+    if(d_.count() <= 1){
+        return;
+    }
+    QList<QWalletPtr> sorted = d_;
+    switch (role) {
+    case wallet_createDate_Role:
+    {
+        if(Qt::DescendingOrder == order){
+            std::stable_sort(sorted.begin(), sorted.end(), sortWalletByNameDescending);
         }
-            break;
-        default:
-            break;
+        else{
+            std::stable_sort(sorted.begin(), sorted.end(), sortWalletByNameAscending);
         }
     }
-    endResetModel();
+        break;
+    default:
+        break;
+    }
+    if(sorted == d_){
+        return;
+    }
+    // Move rows in place so views keep their delegates instead of rebuilding them
+    emit layoutAboutToBeChanged();
+    const QModelIndexList oldPersistent = persistentIndexList();
+    QHash<Wallet*, int> newRows;
+    for (int i = 0; i < sorted.count(); i++) {
+        newRows.insert(sorted.at(i).data(), i);
+    }
+    QModelIndexList newPersistent;
+    for (const QModelIndex &idx : oldPersistent) {
+        newPersistent << index(newRows.value(d_.at(idx.row()).data(), idx.row()));
+    }
+    d_ = sorted;
+    rebuildIndex();
+    changePersistentIndexList(oldPersistent, newPersistent);
+    emit layoutChanged();
 }
 
 bool WalletListModel::containsId(const QString &id)
 {
-    foreach (QWalletPtr i , d_ ){
-        if(0 == QString::compare(i.data()->id(), id, Qt::CaseInsensitive)){
-            return true;
-        }
-    }
-    return false;
+    return indexOfId(id) >= 0;
 }
 
 void WalletListModel::updateSharedWalletById(const QString &wallet_id, const QString &room_id, const QString &init_id,const QString &name)
 {
-    beginResetModel();
-    foreach (QWalletPtr it , d_ ){
-        if(0 == QString::compare(it.data()->id(), wallet_id, Qt::CaseInsensitive)){
-            it.data()->setIsSharedWallet(true);
-            it.data()->setRoomId(room_id);
-            it.data()->setInitEventId(init_id);
-            it.data()->setName(name);
-        }
+    int i = indexOfId(wallet_id);
+    if(i >= 0){
+        QWalletPtr it = d_.at(i);
+        it.data()->beginUpdate();
+        it.data()->setIsSharedWallet(true);
+        it.data()->setRoomId(room_id);
+        it.data()->setInitEventId(init_id);
+        it.data()->setName(name);
+        it.data()->endUpdate();
+        emit dataChanged(index(i),index(i), {wallet_isSharedWallet_Role, wallet_Name_Role});
     }
-    endResetModel();
 }
 
 void WalletListModel::updateSignerOfRoomWallet(const QString &wallet_id, const SignerAssigned &signer)
 {
-    foreach (QWalletPtr it , d_ ){
-        if(0 == QString::compare(it.data()->id(), wallet_id, Qt::CaseInsensitive)){
-            if(it.data()->singleSignersAssigned()){
-                it.data()->singleSignersAssigned()->updateSignerOfRoomWallet(signer);
+    int i = indexOfId(wallet_id);
+    if(i >= 0 && d_.at(i).data()->singleSignersAssigned()){
+        d_.at(i).data()->singleSignersAssigned()->updateSignerOfRoomWallet(signer);
+    }
+}
+
+void WalletListModel::mergeWallets(const std::vector<nunchuk::Wallet> &wallets)
+{
+    const quint64 emittedBefore = NotifyBatchStats::emitted.loadAcquire();
+    const quint64 suppressedBefore = NotifyBatchStats::suppressed.loadAcquire();
+    const int oldCount = d_.count();
+    QSet<QString> incoming;
+    for (const nunchuk::Wallet &w : wallets) {
+        QString wallet_id = QString::fromStdString(w.get_id());
+        incoming.insert(wallet_id.toLower());
+        int i = indexOfId(wallet_id);
+        if(i >= 0){
+            QWalletPtr it = d_.at(i);
+            QVector<int> roles;
+            // changedRoles covers every field convert() reads, so an unchanged wallet is left alone
+            if(!changedRoles(it.data()->wallet(), w, roles)){
+                continue;
+            }
+            it.data()->convert(w);
+            if(!roles.isEmpty()){
+                emit dataChanged(index(i),index(i), roles);
+            }
+            else{
+                emit dataChanged(index(i),index(i));
             }
         }
+        else{
+            addWallet(bridge::convertWallet(w));
+        }
+    }
+    for (int i = d_.count() - 1; i >= 0; i--) {
+        if(!incoming.contains(d_.at(i).data()->id().toLower())){
+            beginRemoveRows(QModelIndex(), i, i);
+            d_.removeAt(i);
+            endRemoveRows();
+        }
+    }
+    rebuildIndex();
+    if(m_sortRole >= 0){
+        requestSort(m_sortRole, m_sortOrder);
+    }
+    if(oldCount != d_.count()){
+        emit containsGroupChanged();
+    }
+    DBG_INFO << wallets.size() << "wallets merged; signals emitted" << NotifyBatchStats::emitted.loadAcquire() - emittedBefore
+             << "suppressed" << NotifyBatchStats::suppressed.loadAcquire() - suppressedBefore;
+}
+
+int WalletListModel::indexOfId(const QString &walletId) const
+{
+    return m_indexById.value(walletId.toLower(), -1);
+}
+
+void WalletListModel::rebuildIndex()
+{
+    m_indexById.clear();
+    m_indexById.reserve(d_.count());
+    for (int i = 0; i < d_.count(); i++) {
+        if(d_.at(i).data()){
+            m_indexById.insert(d_.at(i).data()->id().toLower(), i);
+        }
+    }
+}
+
+bool WalletListModel::changedRoles(const nunchuk::Wallet &from, const nunchuk::Wallet &to, QVector<int> &roles) const
+{
+    roles.clear();
+    if(from.get_name() != to.get_name()){
+        roles << wallet_Name_Role;
+    }
+    if(from.get_m() != to.get_m()){
+        roles << wallet_M_Role;
+    }
+    if(from.get_address_type() != to.get_address_type()){
+        roles << wallet_AddressType_Role;
+    }
+    if(from.get_unconfirmed_balance() != to.get_unconfirmed_balance()){
+        roles << wallet_Balance_Role << wallet_BalanceBTC_Role << wallet_BalanceCurrency_Role;
+    }
+    if(from.get_create_date() != to.get_create_date()){
+        roles << wallet_createDate_Role;
+    }
+    if(from.is_escrow() != to.is_escrow()){
+        roles << wallet_Escrow_Role;
+    }
+    bool signersChanged = from.get_signers().size() != to.get_signers().size();
+    for (size_t i = 0; !signersChanged && i < to.get_signers().size(); i++) {
+        const nunchuk::SingleSigner &a = from.get_signers()[i];
+        const nunchuk::SingleSigner &b = to.get_signers()[i];
+        signersChanged = a.get_master_fingerprint() != b.get_master_fingerprint()
+                         || a.get_derivation_path() != b.get_derivation_path()
+                         || a.get_name() != b.get_name()
+                         || a.get_last_health_check() != b.get_last_health_check()
+                         || a.get_type() != b.get_type()
+                         || a.get_tags() != b.get_tags()
+                         || a.get_xpub() != b.get_xpub()
+                         || a.get_public_key() != b.get_public_key();
+    }
+    if(signersChanged || from.get_n() != to.get_n()){
+        roles << wallet_N_Role << wallet_SingleSignerList_Role;
     }
+    // Fields without a role of their own are reported as a whole-row change
+    return !roles.isEmpty()
+           || from.get_description() != to.get_description()
+           || from.get_gap_limit() != to.get_gap_limit()
+           || from.need_backup() != to.need_backup();
 }
 
 QList<QWalletPtr> WalletListModel::fullList() const
@@ -2169,6 +2398,7 @@ void WalletListModel::cleardata()
 {
     beginResetModel();
     d_.clear();
+    m_indexById.clear();
     endResetModel();
 }
 
@@ -30,6 +30,9 @@
 #include "Commons/Slugs.h"
 #include <QJsonArray>
 #include "Commons/ReplaceKeyFreeUser.h"
+#include "Commons/NotifyBatch.h"
+#include "AddressModel.h"
+#include "Servers/JsonArrayStream.h"
 
 class Wallet : public QObject, public Slugs, public ReplaceKeyFreeUser
 {
@@ -54,6 +57,10 @@ class Wallet : public QObject, public Slugs, public ReplaceKeyFreeUser
     Q_PROPERTY(QStringList  walletunUsedAddressList                 READ unUsedAddressList                              NOTIFY unUsedAddressChanged)
     Q_PROPERTY(QStringList  walletusedChangedAddressList            READ usedChangeAddressList                          NOTIFY usedChangeAddressChanged)
     Q_PROPERTY(QStringList  walletunUsedChangedAddressList          READ unUsedChangeddAddressList                      NOTIFY unUsedChangeAddressChanged)
+    Q_PROPERTY(AddressListModel* walletUsedAddressModel             READ usedAddressModel                               CONSTANT)
+    Q_PROPERTY(AddressListModel* walletUnUsedAddressModel           READ unUsedAddressModel                             CONSTANT)
+    Q_PROPERTY(AddressListModel* walletUsedChangeAddressModel       READ usedChangeAddressModel                         CONSTANT)
+    Q_PROPERTY(AddressListModel* walletUnUsedChangeAddressModel     READ unUsedChangeAddressModel                       CONSTANT)
     Q_PROPERTY(bool         capableCreate                           READ capableCreate                                  NOTIFY capableCreateChanged)
     Q_PROPERTY(QString      walletDescription                       READ description            WRITE setDescription    NOTIFY descriptionChanged)
     Q_PROPERTY(QString      walletDescriptior                       READ descriptior                                    NOTIFY descriptiorChanged)
@@ -106,7 +113,12 @@ public:
     };
     void init();
     void convert(const Wallet *w);
-    void convert(const nunchuk::Wallet &w);
+    void convert(nunchuk::Wallet w, bool fetchDashboard = true);
+    QGroupDashboardPtr pendingDashboard() const;
+    static void refreshDashboard(const QGroupDashboardPtr &dash);
+    // Property signals raised between these are emitted once each at the outermost endUpdate()
+    void beginUpdate();
+    void endUpdate();
 
     QString id() const;
     int m() const;
@@ -145,6 +157,11 @@ public:
     void setUsedChangeAddressList(const QStringList &usedChangeAddressList);
     QStringList unUsedChangeddAddressList() const;
     void setUnUsedChangeddAddressList(const QStringList &unUsedChangeddAddressList);
+    AddressListModel* usedAddressModel() const;
+    AddressListModel* unUsedAddressModel() const;
+    AddressListModel* usedChangeAddressModel() const;
+    AddressListModel* unUsedChangeAddressModel() const;
+    AddressBalanceCache* addressBalances() const;
     QString descriptior() const;
     void setDescriptior(const QString &descriptior);
 
@@ -249,6 +266,9 @@ protected:
     //User wallet
     void GetUserTxs();
     void GetUserCancelledTxs();
+    void RemoveCancelledTxs(const QJsonArray &transactions);
+    bool HasLocalTransaction(const QString &transaction_id);
+    void ImportServerTxs(const std::function<bool(JsonArrayStream::Element)> &fetch);
     void GetUserTxNotes();
     QString GetUserTxNote(const QString &txid);
     QTransactionPtr SyncUserTxs(const nunchuk::Transaction &tx);
@@ -289,6 +309,11 @@ private:
     QStringList m_unUsedAddressList {};
     QStringList m_usedChangeAddressList {};
     QStringList m_unUsedChangedAddressList {};
+    QAddressBalanceCachePtr m_addressBalances;
+    QAddressListModelPtr m_usedAddressModel;
+    QAddressListModelPtr m_unUsedAddressModel;
+    QAddressListModelPtr m_usedChangeAddressModel;
+    QAddressListModelPtr m_unUsedChangeAddressModel;
     QJsonArray m_aliasMembers {};
     // capable to create wallet
 
@@ -303,6 +328,7 @@ private:
     nunchuk::Wallet m_wallet {false};
     QList<DracoUser> m_roomMembers;
     static int m_flow;
+    NotifyBatch<Wallet> m_notify {this};
 signals:
     void idChanged();
     void mChanged();
@@ -372,6 +398,7 @@ public:
     int count() const;
     Q_INVOKABLE  QVariant get(int row);
     void addWallet(const QWalletPtr &wallet);
+    void addWallets(std::vector<nunchuk::Wallet> wallets);
     void replaceWallet(const QWalletPtr &wallet);
     void addSharedWallet(const QWalletPtr &wallet);
     void updateBalance(const QString &walletId, const qint64 balance);
@@ -394,6 +421,7 @@ public:
     bool containsId(const QString& id);
     void updateSharedWalletById(const QString &wallet_id, const QString &room_id, const QString &init_id, const QString &name);
     void updateSignerOfRoomWallet(const QString &wallet_id, const SignerAssigned &signer);
+    void mergeWallets(const std::vector<nunchuk::Wallet> &wallets);
 
     enum WalletRoles {
         wallet_Id_Role,
@@ -432,7 +460,13 @@ public slots:
     QVariant removeOrNot(const QString& masterFingerPrint);
     bool hasAssistedWallet() const;
 private:
+    int indexOfId(const QString& walletId) const;
+    void rebuildIndex();
+    bool changedRoles(const nunchuk::Wallet &from, const nunchuk::Wallet &to, QVector<int> &roles) const;
     QList<QWalletPtr> d_;
+    QHash<QString, int> m_indexById;
+    int m_sortRole {-1};
+    int m_sortOrder {Qt::AscendingOrder};
 
 signals:
     void containsGroupChanged();
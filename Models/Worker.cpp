@@ -28,6 +28,7 @@
 #include "Premiums/QGroupWallets.h"
 #include "ServiceSetting.h"
 #include "Premiums/QWalletServicesTag.h"
+#include "Commons/DeviceDiscovery.h"
 
 Worker *Worker::mInstance = NULL;
 Worker::Worker()
@@ -52,6 +53,7 @@ Worker *Worker::create(QThread *thread)
 void Worker::slotStartCreateMasterSigner(const QString &name,
                                          const int deviceIndex)
 {
+    DeviceDiscovery::Hold hold;
     QWarningMessage msg;
     AppModel::instance()->setAddSignerStep(0);
     AppModel::instance()->setAddSignerPercentage(0);
@@ -117,14 +119,22 @@ void Worker::slotStartCreateRemoteSigner(const QString &name,
 }
 
 void Worker::slotStartScanDevices(const int state_id) {
+    // Asked for by the user or after a device interaction: always enumerate again
     QWarningMessage msg;
-    std::vector<nunchuk::Device> deviceList {};
-    if (AppModel::instance()->isSignIn()) {
-        deviceList = qUtils::GetDevices(bridge::hwiPath(), msg);
-        DBG_INFO << "deviceList.size():" << deviceList.size();
-    } else {
-        deviceList = bridge::nunchukGetOriginDevices(msg);
-    }
+    std::vector<nunchuk::Device> deviceList = DeviceDiscovery::instance()->scan(msg);
+    DBG_INFO << "deviceList.size():" << deviceList.size();
+    emit finishScanDevices(state_id,
+                           deviceList,
+                           msg.what(),
+                           msg.type(),
+                           msg.code());
+}
+
+void Worker::slotStartReportDevices(const int state_id) {
+    // The background poll has just enumerated; hand its result to the screen
+    QWarningMessage msg;
+    std::vector<nunchuk::Device> deviceList = DeviceDiscovery::instance()->devices(msg);
+    DBG_INFO << "deviceList.size():" << deviceList.size();
     emit finishScanDevices(state_id,
                            deviceList,
                            msg.what(),
@@ -138,6 +148,7 @@ void Worker::slotStartSigningTransaction(const QString &walletId,
                                          bool isSoftware)
 {
     DBG_INFO << walletId << deviceXfp << isSoftware << txid;
+    DeviceDiscovery::Hold hold;
     QTransactionPtr transaction = AppModel::instance()->transactionInfoPtr();
     if(transaction){
         QWarningMessage msgwarning;
@@ -211,6 +222,7 @@ void Worker::slotStartHealthCheckMasterSigner(const int state_id,
                                               const QString &xfp,
                                               const QString &message)
 {
+    DeviceDiscovery::Hold hold;
     QString out_signature = "";
     QString out_path = "";
     QWarningMessage msgwarning;
@@ -269,6 +281,7 @@ void Worker::slotStartDisplayAddress(const QString &wallet_id,
 {
     DBG_INFO << wallet_id << address;
     emit AppModel::instance()->displayAddressOnDevices();
+    DeviceDiscovery::Hold hold;
     bool ret = false;
     QWarningMessage msg;
     QDeviceListModelPtr deviceList = bridge::nunchukGetDevices(msg);
@@ -478,11 +491,14 @@ void Worker::slotStartGetEstimatedFee()
 
 void Worker::slotStartSendPinToDevice(const int state_id, const int device_idx, const QString &pin)
 {
+    DeviceDiscovery::Hold hold;
     QWarningMessage msgwarning;
     if(AppModel::instance()->deviceList()){
         QDevicePtr selectedDv = AppModel::instance()->deviceList()->getDeviceByIndex(device_idx) ;
         if(selectedDv && selectedDv.data()->needsPinSent()){
             bridge::nunchukSendPinToDevice(selectedDv, pin, msgwarning);
+            // The device unlocks; the next scan must see it rather than the cached locked entry
+            DeviceDiscovery::instance()->invalidate();
         }
     }
     emit finishSendPinToDevice(state_id,
@@ -493,11 +509,13 @@ void Worker::slotStartSendPinToDevice(const int state_id, const int device_idx,
 
 void Worker::slotStartSendPassphraseToDevice(const int state_id, const int device_idx, const QString &pprase)
 {
+    DeviceDiscovery::Hold hold;
     QWarningMessage msgwarning;
     if(AppModel::instance()->deviceList()){
         QDevicePtr selectedDv = AppModel::instance()->deviceList()->getDeviceByIndex(device_idx) ;
         if(selectedDv && selectedDv.data()->needsPassPhraseSent()){
             bridge::nunchukSendPassphraseToDevice(selectedDv, pprase, msgwarning);
+            DeviceDiscovery::instance()->invalidate();
         }
     }
     emit finishSendPassphraseToDevice(state_id,
@@ -593,9 +611,7 @@ void Worker::slotStartSyncWalletDb(const QString &wallet_id)
         std::vector<nunchuk::Transaction> trans_result = bridge::nunchukGetOriginTransactionHistory(wallet_id);
         emit finishGetTransactionHistory(wallet_id, trans_result);
 
-        QStringList used_addr = bridge::nunchukGetUsedAddresses(wallet_id, false);
-        QStringList used_change_addr = bridge::nunchukGetUsedAddresses(wallet_id, true);
-
+        // Used addresses can run into the thousands, the receive and change-address screens load them on entry
         QStringList unused_addr = bridge::nunchukGetUnusedAddresses(wallet_id, false);
         QStringList unsued_chabge_addr = bridge::nunchukGetUnusedAddresses(wallet_id, true);
 
@@ -611,8 +627,6 @@ void Worker::slotStartSyncWalletDb(const QString &wallet_id)
             }
         }
         if(wallet){
-            wallet.data()->setUsedAddressList(used_addr);
-            wallet.data()->setUsedChangeAddressList(used_change_addr);
             wallet.data()->setunUsedAddressList(unused_addr);
             wallet.data()->setUnUsedChangeddAddressList(unsued_chabge_addr);
             if(wallet){
@@ -656,6 +670,7 @@ Controller::Controller() {
 
     // Get devices
     connect(this, &Controller::startScanDevices, worker, &Worker::slotStartScanDevices, Qt::QueuedConnection);
+    connect(this, &Controller::startReportDevices, worker, &Worker::slotStartReportDevices, Qt::QueuedConnection);
     connect(worker, &Worker::finishScanDevices, this, &Controller::slotFinishScanDevices, Qt::QueuedConnection);
 
     // Balance changed
@@ -1263,6 +1278,7 @@ void Controller::slotFinishGetTransactionHistory(const QString wallet_id,
     if(wallet){
         wallet.data()->transactionHistory()->updateTransaction(wallet_id, ret);
         wallet.data()->transactionHistory()->requestSort(TransactionListModel::TransactionRoles::transaction_blocktime_role, Qt::DescendingOrder);
+        wallet.data()->transactionHistory()->saveSnapshot(wallet_id);
         emit wallet.data()->transactionHistoryChanged();
     }
     emit finishedGetTransactionHistory();
@@ -1277,6 +1293,7 @@ void Controller::slotCheckAndUnlockDevice(const int state_id)
             if(selectedDv){
                 DBG_INFO << selectedDv.data()->needsPinSent() << selectedDv.data()->needsPassPhraseSent();
                 if(selectedDv.data()->needsPinSent()){
+                    DeviceDiscovery::Hold hold;
                     QWarningMessage msgwarning;
                     bridge::nunchukPromtPinOnDevice(selectedDv, msgwarning);
                     if((int)EWARNING::WarningType::NONE_MSG == msgwarning.type()){
@@ -1377,9 +1394,18 @@ void Controller::slotFinishReloadRemoteSigners(std::vector<nunchuk::SingleSigner
 void Controller::slotFinishReloadWallets(std::vector<nunchuk::Wallet> wallets)
 {
     QFunctionTime f(__PRETTY_FUNCTION__);
-    QWalletListModelPtr ret = bridge::nunchukConvertWallets(wallets);
+    QWalletListModelPtr ret = AppModel::instance()->walletListPtr();
+    if(ret && ret->rowCount() > 0){
+        // Only wallets that are new or differ from the row get converted; existing rows stay in place
+        ret->mergeWallets(wallets);
+    }
+    else{
+        ret = bridge::nunchukConvertWallets(std::move(wallets));
+        if(ret){
+            AppModel::instance()->setWalletList(ret);
+        }
+    }
     if(ret){
-        AppModel::instance()->setWalletList(ret);
         QString lastWalletId = bridge::nunchukGetSelectedWallet();
         int lastIndex = lastWalletId == "" ? 0 : AppModel::instance()->walletList()->getWalletIndexById(lastWalletId);
         lastIndex = max(0, lastIndex);
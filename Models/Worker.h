@@ -65,6 +65,7 @@ public slots:
                                      const int event);
 
     void slotStartScanDevices(const int state_id);
+    void slotStartReportDevices(const int state_id);
 
     void slotStartSigningTransaction(const QString &walletId,
                                      const QString &txid,
@@ -371,6 +372,7 @@ signals:
                                  const int event);
 
     void startScanDevices(const int state_id);
+    void startReportDevices(const int state_id);
 
     void startSigningTransaction(const QString &walletId,
                                  const QString &txid,
@@ -2,3 +2,395 @@
 #include <QFile>
 #include <QTextStream>
 #include <QDateTime>
+#include <QFileInfo>
+#include <QtEndian>
+
+namespace {
+const quint32 ZIP_LOCAL_HEADER   = 0x04034b50;
+const quint32 ZIP_CENTRAL_HEADER = 0x02014b50;
+const quint32 ZIP_END_OF_CENTRAL = 0x06054b50;
+const quint16 ZIP_VERSION        = 20;
+const quint16 ZIP_FLAG_UTF8      = 0x0800;
+// Offsets of crc32 inside a local file header; compressed and uncompressed sizes follow it
+const int     ZIP_LOCAL_CRC_OFFSET = 14;
+
+const char *SHEET_HEAD = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                         "<worksheet xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\"><sheetData>";
+const char *SHEET_TAIL = "</sheetData></worksheet>";
+
+quint32 crc32Update(quint32 crc, const char *data, int size)
+{
+    static quint32 table[256];
+    static bool ready = [] {
+        for (quint32 i = 0; i < 256; i++) {
+            quint32 c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+        return true;
+    }();
+    Q_UNUSED(ready);
+    crc = ~crc;
+    for (int i = 0; i < size; i++) {
+        crc = table[(crc ^ static_cast<quint8>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void append16(QByteArray &out, quint16 value)
+{
+    char bytes[2];
+    qToLittleEndian(value, bytes);
+    out.append(bytes, 2);
+}
+
+void append32(QByteArray &out, quint32 value)
+{
+    char bytes[4];
+    qToLittleEndian(value, bytes);
+    out.append(bytes, 4);
+}
+
+QByteArray xmlEscaped(const QString &text)
+{
+    QByteArray out;
+    const QByteArray utf8 = text.toUtf8();
+    out.reserve(utf8.size());
+    for (char c : utf8) {
+        switch (c) {
+        case '&':  out.append("&amp;");  break;
+        case '<':  out.append("&lt;");   break;
+        case '>':  out.append("&gt;");   break;
+        case '"':  out.append("&quot;"); break;
+        case '\t':
+        case '\n':
+        case '\r':
+            out.append(c);
+            break;
+        default:
+            // Other control characters are not allowed in XML 1.0
+            if (static_cast<quint8>(c) >= 0x20) {
+                out.append(c);
+            }
+            break;
+        }
+    }
+    return out;
+}
+
+bool isNumeric(const QVariant &cell)
+{
+    switch (static_cast<int>(cell.type())) {
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Double:
+    case QMetaType::Float:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// QVariant::toString() switches to exponent form for small values (1e-05),
+// which spreadsheets read inconsistently; write fixed-point without trailing zeros
+QByteArray numberText(const QVariant &cell)
+{
+    const int type = static_cast<int>(cell.type());
+    if (type != QMetaType::Double && type != QMetaType::Float) {
+        return numberText(cell);
+    }
+    QString text = QString::number(cell.toDouble(), 'f', 10);
+    while (text.endsWith('0')) {
+        text.chop(1);
+    }
+    if (text.endsWith('.')) {
+        text.chop(1);
+    }
+    return text.toUtf8();
+}
+}
+
+QExcelWriter::QExcelWriter(Format format) : m_format(format)
+{
+
+}
+
+QExcelWriter::~QExcelWriter()
+{
+    if (m_open) {
+        abort();
+    }
+}
+
+QExcelWriter::Format QExcelWriter::formatForPath(const QString &filePath)
+{
+    return QFileInfo(filePath).suffix().compare("xlsx", Qt::CaseInsensitive) == 0 ? Format::XLSX : Format::CSV;
+}
+
+bool QExcelWriter::open(const QString &filePath, const QStringList &header, const QString &sheetName)
+{
+    m_file.setFileName(filePath);
+    if (!m_file.open(QIODevice::WriteOnly)) {
+        m_error = m_file.errorString();
+        return false;
+    }
+    m_open = true;
+    m_rows = 0;
+    m_entries.clear();
+    m_buffer.clear();
+    m_buffer.reserve(BUFFER_SIZE);
+    QDateTime now = QDateTime::currentDateTime();
+    m_dosTime = static_cast<quint16>((now.time().hour() << 11) | (now.time().minute() << 5) | (now.time().second() / 2));
+    m_dosDate = static_cast<quint16>(((now.date().year() - 1980) << 9) | (now.date().month() << 5) | now.date().day());
+
+    if (m_format == Format::CSV) {
+        // BOM so spreadsheet applications pick UTF-8 for notes and labels
+        write("\xEF\xBB\xBF");
+    }
+    else {
+        writeEntry("[Content_Types].xml",
+                   "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                   "<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+                   "<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+                   "<Default Extension=\"xml\" ContentType=\"application/xml\"/>"
+                   "<Override PartName=\"/xl/workbook.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.sheet.main+xml\"/>"
+                   "<Override PartName=\"/xl/worksheets/sheet1.xml\" ContentType=\"application/vnd.openxmlformats-officedocument.spreadsheetml.worksheet+xml\"/>"
+                   "</Types>");
+        writeEntry("_rels/.rels",
+                   "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                   "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+                   "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/officeDocument\" Target=\"xl/workbook.xml\"/>"
+                   "</Relationships>");
+        writeEntry("xl/workbook.xml",
+                   "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                   "<workbook xmlns=\"http://schemas.openxmlformats.org/spreadsheetml/2006/main\" "
+                   "xmlns:r=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships\">"
+                   "<sheets><sheet name=\"" + xmlEscaped(sheetName.left(31)) + "\" sheetId=\"1\" r:id=\"rId1\"/></sheets>"
+                   "</workbook>");
+        writeEntry("xl/_rels/workbook.xml.rels",
+                   "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                   "<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+                   "<Relationship Id=\"rId1\" Type=\"http://schemas.openxmlformats.org/officeDocument/2006/relationships/worksheet\" Target=\"worksheets/sheet1.xml\"/>"
+                   "</Relationships>");
+        beginEntry("xl/worksheets/sheet1.xml");
+        write(SHEET_HEAD);
+    }
+    if (!header.isEmpty()) {
+        QVariantList cells;
+        for (const QString &title : header) {
+            cells.append(title);
+        }
+        writeRow(cells);
+        // The header is not a data row
+        m_rows = 0;
+    }
+    return m_error.isEmpty();
+}
+
+bool QExcelWriter::writeRow(const QVariantList &cells)
+{
+    if (!m_open) {
+        return false;
+    }
+    QByteArray row;
+    if (m_format == Format::CSV) {
+        for (int i = 0; i < cells.size(); i++) {
+            if (i > 0) {
+                row.append(',');
+            }
+            row.append(csvCell(cells.at(i)));
+        }
+        row.append("\r\n");
+    }
+    else {
+        row.append("<row>");
+        for (const QVariant &cell : cells) {
+            row.append(xlsxCell(cell));
+        }
+        row.append("</row>");
+    }
+    m_rows++;
+    return write(row);
+}
+
+bool QExcelWriter::close()
+{
+    if (!m_open) {
+        return false;
+    }
+    if (m_format == Format::XLSX) {
+        write(SHEET_TAIL);
+        endEntry();
+        writeCentralDirectory();
+    }
+    flush();
+    m_open = false;
+    if (!m_error.isEmpty()) {
+        m_file.cancelWriting();
+        m_file.commit();
+        return false;
+    }
+    if (!m_file.commit()) {
+        m_error = m_file.errorString();
+        return false;
+    }
+    return true;
+}
+
+void QExcelWriter::abort()
+{
+    if (m_open) {
+        m_open = false;
+        m_file.cancelWriting();
+        m_file.commit();
+    }
+}
+
+qint64 QExcelWriter::rowCount() const
+{
+    return m_rows;
+}
+
+QString QExcelWriter::errorString() const
+{
+    return m_error;
+}
+
+bool QExcelWriter::write(const QByteArray &bytes)
+{
+    if (m_inEntry) {
+        m_entry.crc = crc32Update(m_entry.crc, bytes.constData(), bytes.size());
+        m_entry.size += static_cast<quint32>(bytes.size());
+    }
+    m_buffer.append(bytes);
+    if (m_buffer.size() >= BUFFER_SIZE) {
+        return flush();
+    }
+    return m_error.isEmpty();
+}
+
+bool QExcelWriter::flush()
+{
+    if (m_buffer.isEmpty()) {
+        return m_error.isEmpty();
+    }
+    if (m_file.write(m_buffer) != m_buffer.size()) {
+        m_error = m_file.errorString();
+    }
+    m_buffer.clear();
+    return m_error.isEmpty();
+}
+
+bool QExcelWriter::beginEntry(const QString &name)
+{
+    flush();
+    m_entry = ZipEntry();
+    m_entry.name = name.toUtf8();
+    m_entry.offset = static_cast<quint32>(m_file.pos());
+    QByteArray header;
+    append32(header, ZIP_LOCAL_HEADER);
+    append16(header, ZIP_VERSION);
+    append16(header, ZIP_FLAG_UTF8);
+    append16(header, 0);    // stored
+    append16(header, m_dosTime);
+    append16(header, m_dosDate);
+    append32(header, 0);    // crc32, patched by endEntry()
+    append32(header, 0);    // compressed size
+    append32(header, 0);    // uncompressed size
+    append16(header, static_cast<quint16>(m_entry.name.size()));
+    append16(header, 0);
+    header.append(m_entry.name);
+    write(header);
+    m_inEntry = true;
+    return m_error.isEmpty();
+}
+
+bool QExcelWriter::endEntry()
+{
+    m_inEntry = false;
+    if (!flush()) {
+        return false;
+    }
+    QByteArray sizes;
+    append32(sizes, m_entry.crc);
+    append32(sizes, m_entry.size);
+    append32(sizes, m_entry.size);
+    qint64 end = m_file.pos();
+    if (!m_file.seek(m_entry.offset + ZIP_LOCAL_CRC_OFFSET) || m_file.write(sizes) != sizes.size() || !m_file.seek(end)) {
+        m_error = m_file.errorString();
+        return false;
+    }
+    m_entries.append(m_entry);
+    return true;
+}
+
+bool QExcelWriter::writeEntry(const QString &name, const QByteArray &content)
+{
+    return beginEntry(name) && write(content) && endEntry();
+}
+
+bool QExcelWriter::writeCentralDirectory()
+{
+    flush();
+    quint32 start = static_cast<quint32>(m_file.pos());
+    QByteArray directory;
+    for (const ZipEntry &entry : m_entries) {
+        append32(directory, ZIP_CENTRAL_HEADER);
+        append16(directory, ZIP_VERSION);
+        append16(directory, ZIP_VERSION);
+        append16(directory, ZIP_FLAG_UTF8);
+        append16(directory, 0);
+        append16(directory, m_dosTime);
+        append16(directory, m_dosDate);
+        append32(directory, entry.crc);
+        append32(directory, entry.size);
+        append32(directory, entry.size);
+        append16(directory, static_cast<quint16>(entry.name.size()));
+        append16(directory, 0);     // extra
+        append16(directory, 0);     // comment
+        append16(directory, 0);     // disk
+        append16(directory, 0);     // internal attributes
+        append32(directory, 0);     // external attributes
+        append32(directory, entry.offset);
+        directory.append(entry.name);
+    }
+    quint32 size = static_cast<quint32>(directory.size());
+    append32(directory, ZIP_END_OF_CENTRAL);
+    append16(directory, 0);
+    append16(directory, 0);
+    append16(directory, static_cast<quint16>(m_entries.size()));
+    append16(directory, static_cast<quint16>(m_entries.size()));
+    append32(directory, size);
+    append32(directory, start);
+    append16(directory, 0);
+    return write(directory);
+}
+
+QByteArray QExcelWriter::csvCell(const QVariant &cell) const
+{
+    if (isNumeric(cell)) {
+        return numberText(cell);
+    }
+    QString text = cell.toString();
+    // Text that a spreadsheet would evaluate as a formula is kept literal
+    if (!text.isEmpty() && QString("=+-@").contains(text.at(0))) {
+        text.prepend('\'');
+    }
+    if (text.contains(',') || text.contains('"') || text.contains('\n') || text.contains('\r')) {
+        text.replace("\"", "\"\"");
+        return "\"" + text.toUtf8() + "\"";
+    }
+    return text.toUtf8();
+}
+
+QByteArray QExcelWriter::xlsxCell(const QVariant &cell) const
+{
+    if (isNumeric(cell)) {
+        return "<c><v>" + numberText(cell) + "</v></c>";
+    }
+    return "<c t=\"inlineStr\"><is><t xml:space=\"preserve\">" + xmlEscaped(cell.toString()) + "</t></is></c>";
+}
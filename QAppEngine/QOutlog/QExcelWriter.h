@@ -0,0 +1,67 @@
+#ifndef QEXCELWRITER_H
+#define QEXCELWRITER_H
+
+#include <QSaveFile>
+#include <QString>
+#include <QStringList>
+#include <QVariantList>
+#include <QList>
+
+// Streaming tabular writer for CSV and XLSX exports. Rows go straight to disk
+// through a small buffer, so the document is never held in memory. XLSX is
+// written as a single-sheet workbook with inline strings inside a minimal zip
+// (stored entries whose headers are patched once each entry is complete).
+// Numeric cells stay numeric in XLSX; everything else is written as text.
+class QExcelWriter
+{
+public:
+    enum class Format {
+        CSV,
+        XLSX,
+    };
+    explicit QExcelWriter(Format format = Format::CSV);
+    ~QExcelWriter();
+
+    static Format formatForPath(const QString &filePath);
+
+    bool open(const QString &filePath, const QStringList &header, const QString &sheetName = "Sheet1");
+    bool writeRow(const QVariantList &cells);
+    bool close();
+    // Drops the partial file; an existing file at the same path is left untouched
+    void abort();
+
+    qint64  rowCount() const;
+    QString errorString() const;
+
+    static constexpr int BUFFER_SIZE = 64 * 1024;
+
+private:
+    struct ZipEntry {
+        QByteArray  name;
+        quint32     crc {0};
+        quint32     size {0};
+        quint32     offset {0};
+    };
+    bool write(const QByteArray &bytes);
+    bool flush();
+    bool beginEntry(const QString &name);
+    bool endEntry();
+    bool writeEntry(const QString &name, const QByteArray &content);
+    bool writeCentralDirectory();
+    QByteArray csvCell(const QVariant &cell) const;
+    QByteArray xlsxCell(const QVariant &cell) const;
+
+    Format          m_format;
+    QSaveFile       m_file;
+    QByteArray      m_buffer;
+    QList<ZipEntry> m_entries;
+    ZipEntry        m_entry;
+    bool            m_inEntry {false};
+    bool            m_open {false};
+    quint16         m_dosTime {0};
+    quint16         m_dosDate {0};
+    qint64          m_rows {0};
+    QString         m_error;
+};
+
+#endif // QEXCELWRITER_H
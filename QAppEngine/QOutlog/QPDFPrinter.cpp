@@ -23,6 +23,8 @@
 #include "QtGui/qpainter.h"
 #include "QOutlog.h"
 #include "qUtils.h"
+#include "QBarcodeGenerator.h"
+#include <QtConcurrent>
 
 QPDFPrinter::QPDFPrinter(QObject *parent) : QObject{parent}, m_printer{new QPrinter(QPrinter::HighResolution)}
 {
@@ -40,6 +42,24 @@ QPDFPrinter *QPDFPrinter::instance()
 void QPDFPrinter::printQRCodeToPdf(const QString &pdfPath, QVariant objects)
 {
     QList<QVariant> list = objects.toList();
+    // QR items are re-encoded from their text and drawn as vectors; grabbing is only the fallback
+    QStringList texts;
+    for (auto item : list)
+    {
+        QObject *obj = item.value<QObject *>();
+        QVariant text = obj ? obj->property("textInput") : QVariant();
+        if (!text.isValid())
+        {
+            texts.clear();
+            break;
+        }
+        texts.append(text.toString());
+    }
+    if (!texts.isEmpty())
+    {
+        printQRTextsToPdf(pdfPath, texts);
+        return;
+    }
     QList<QImage> images;
     images.clear();
     for (auto item : list)
@@ -141,3 +161,43 @@ void QPDFPrinter::printImagesToPdf(const QString &pdfPath, const QList<QImage> &
     }
 }
 
+
+void QPDFPrinter::printQRTextsToPdf(const QString &pdfPath, const QStringList &texts)
+{
+    if (m_printer) {
+        QFunctionTime f(QString("printQRTextsToPdf %1 pages").arg(texts.size()));
+        QString file_path = qUtils::QGetFilePath(pdfPath);
+        m_printer->setOutputFileName(file_path);
+        QPainter painter;
+        if (!painter.begin(m_printer)) {
+            DBG_INFO << "Failed to open file, is it writable?";
+            return;
+        }
+        QRect printableArea = m_printer->pageLayout().paintRectPixels(m_printer->resolution());
+        int side = qMin(printableArea.width(), printableArea.height());
+        // Center the code on the page
+        QRectF centeredRect((printableArea.width() - side) / 2.0, (printableArea.height() - side) / 2.0, side, side);
+
+        for (int first = 0; first < texts.size(); first += QR_PAGE_BATCH) {
+            // Encoding dominates; a batch is encoded on workers while the painter stays on this thread
+            QStringList batch = texts.mid(first, QR_PAGE_BATCH);
+            QList<QPainterPath> paths = QtConcurrent::blockingMapped<QList<QPainterPath>>(batch, QBarcodeGenerator::modulePath);
+            for (int i = 0; i < paths.size(); ++i) {
+                const QPainterPath &path = paths.at(i);
+                qreal modules = path.boundingRect().width();
+                if (modules > 0) {
+                    painter.save();
+                    painter.translate(centeredRect.topLeft());
+                    painter.scale(side / modules, side / modules);
+                    painter.fillPath(path, Qt::black);
+                    painter.restore();
+                }
+                // If not the last page, we need to start a new page
+                if (first + i < texts.size() - 1) {
+                    m_printer->newPage();
+                }
+            }
+        }
+        painter.end();
+    }
+}
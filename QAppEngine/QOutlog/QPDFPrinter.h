@@ -47,6 +47,10 @@ signals:
 private:
     void printImageToPdf(const QString &pdfPath, QImage image);
     void printImagesToPdf(const QString &pdfPath, const QList<QImage> &images);
+    void printQRTextsToPdf(const QString &pdfPath, const QStringList &texts);
+
+    // QR pages encoded ahead of the painter at a time; bounds memory for long exports
+    static constexpr int QR_PAGE_BATCH = 16;
 
 private:
     QPrinter *m_printer;
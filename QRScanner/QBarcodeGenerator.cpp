@@ -73,6 +73,37 @@ void QBarcodeGenerator::paint(QPainter *painter)
     }
 }
 
+QPainterPath QBarcodeGenerator::modulePath(const QString &text)
+{
+    QPainterPath path;
+    if(text.isEmpty()){
+        return path;
+    }
+    ZXing::MultiFormatWriter writer = ZXing::MultiFormatWriter(ZXing::BarcodeFormat::QRCode)
+                                          .setEncoding(ZXing::CharacterSet::UTF8)
+                                          .setMargin(0)
+                                          .setEccLevel(0);
+    // A zero size keeps the matrix at its native module count
+    ZXing::BitMatrix matrix = writer.encode(text.toStdString(), 0, 0);
+    for (int y = 0; y < matrix.height(); y++) {
+        int x = 0;
+        while (x < matrix.width()) {
+            if(!matrix.get(x, y)){
+                x++;
+                continue;
+            }
+            // Merge horizontal runs so the path stays small
+            int start = x;
+            while (x < matrix.width() && matrix.get(x, y)) {
+                x++;
+            }
+            path.addRect(start, y, x - start, 1);
+        }
+    }
+    path.setFillRule(Qt::WindingFill);
+    return path;
+}
+
 void QBarcodeGenerator::setTextInput(QString arg)
 {
     if (m_textInput != arg){
@@ -27,6 +27,7 @@
 #include <QQuickItem>
 #include <QObject>
 #include <QPainter>
+#include <QPainterPath>
 
 class QBarcodeGenerator : public QQuickPaintedItem
 {
@@ -38,6 +39,8 @@ public:
     ~QBarcodeGenerator();
     QString textInput() const;
     int borderWitdh() const;
+    // QR modules of text as filled rects, one unit per module, for vector output (e.g. PDF)
+    static QPainterPath modulePath(const QString &text);
 protected:
     void paint(QPainter *painter);
 private:
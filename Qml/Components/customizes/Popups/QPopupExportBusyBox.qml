@@ -0,0 +1,78 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+import QtQuick 2.4
+import QtQuick.Controls 1.4
+import QtQuick.Controls 2.3
+import QtQuick.Controls.Styles 1.4
+import QtGraphicalEffects 1.12
+import HMIEVENTS 1.0
+import EWARNING 1.0
+import DataPool 1.0
+import "../../origins"
+import "../../customizes"
+import "../../customizes/Texts"
+import "../../customizes/Buttons"
+import "../../../../localization/STR_QML.js" as STR
+
+QPopup {
+    id: exportBusybox
+    width: parent.width
+    height: parent.height
+    closePolicy: Popup.NoAutoClose
+    property int rows: 0
+    content: Item {
+        id: boxmask
+        width: 300
+        height: 280
+        Column {
+            spacing: 16
+            anchors.centerIn: parent
+            QBusyIndicator {
+                width: 70
+                height: 70
+                anchors.horizontalCenter: parent.horizontalCenter
+            }
+            QText {
+                anchors.horizontalCenter: parent.horizontalCenter
+                font.family: "Lato"
+                font.pixelSize: 14
+                font.weight: Font.Bold
+                text: STR.STR_QML_1621
+            }
+            QText {
+                anchors.horizontalCenter: parent.horizontalCenter
+                font.family: "Lato"
+                font.pixelSize: 14
+                text: STR.STR_QML_1622.arg(exportBusybox.rows)
+            }
+            QTextButton {
+                width: 120
+                height: 36
+                anchors.horizontalCenter: parent.horizontalCenter
+                label.text: STR.STR_QML_035
+                label.font.pixelSize: 16
+                type: eTypeB
+                onButtonClicked: {
+                    TransactionExport.cancel()
+                }
+            }
+        }
+    }
+}
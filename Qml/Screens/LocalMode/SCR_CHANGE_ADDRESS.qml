@@ -183,7 +183,7 @@ QScreen {
                     top: parent.top
                     topMargin: 450
                 }
-                model: AppModel.walletInfo.walletusedChangedAddressList
+                model: AppModel.walletInfo.walletUsedChangeAddressModel
                 ScrollBar.vertical: ScrollBar { active: true }
                 delegate: Rectangle {
                     width: 301
@@ -202,7 +202,7 @@ QScreen {
                         anchors.bottom: parent.bottom
                     }
                     QText {
-                        text: modelData
+                        text: model.address
                         width: (used.currentIndex == index) && (used.focus) ? 244 : 237
                         height: 16
                         anchors.left: parent.left
@@ -221,7 +221,7 @@ QScreen {
                         onClicked: {
                             used.focus = true
                             used.currentIndex = index
-                            addressSelected.text = modelData
+                            addressSelected.text = model.address
                         }
                     }
                 }
@@ -181,7 +181,7 @@ QScreen {
                     top: parent.top
                     topMargin: 450
                 }
-                model: AppModel.walletInfo.walletusedAddressList
+                model: AppModel.walletInfo.walletUsedAddressModel
                 ScrollBar.vertical: ScrollBar { active: true }
                 delegate: Rectangle {
                     width: 301
@@ -200,7 +200,7 @@ QScreen {
                         anchors.bottom: parent.bottom
                     }
                     QText {
-                        text: modelData
+                        text: model.address
                         width: (used.currentIndex == index) && (used.focus) ? 244 : 237
                         height: 16
                         anchors.left: parent.left
@@ -219,8 +219,8 @@ QScreen {
                         onClicked: {
                             used.focus = true
                             used.currentIndex = index
-                            addressSelected.text = modelData
-                            QMLHandle.sendEvent(EVT.EVT_RECEIVE_ADDRESS_BALANCE, modelData)
+                            addressSelected.text = model.address
+                            QMLHandle.sendEvent(EVT.EVT_RECEIVE_ADDRESS_BALANCE, model.address)
                         }
                     }
                 }
@@ -171,6 +171,10 @@ QScreen {
         id: forceRefreshBusybox
     }
 
+    QPopupExportBusyBox {
+        id: exportBusybox
+    }
+
     QPopupToast{
         id:_warning
         x:contenCenter.x + 36
@@ -191,5 +195,30 @@ QScreen {
             displayAddressBusybox.close()
         }
     }
+    Connections {
+        target: TransactionExport
+        onRunningChanged: {
+            if (TransactionExport.running) {
+                exportBusybox.rows = 0
+                exportBusybox.open()
+            }
+        }
+        onProgressChanged: {
+            exportBusybox.rows = TransactionExport.rows
+        }
+        onFinished: {
+            exportBusybox.close()
+            if (ok) {
+                _warning.warningType = EWARNING.SUCCESS_MSG
+                _warning.warningExplain = STR.STR_QML_1623
+                _warning.open()
+            }
+            else if (error_msg !== "") {
+                _warning.warningType = EWARNING.ERROR_MSG
+                _warning.warningExplain = STR.STR_QML_1624.arg(error_msg)
+                _warning.open()
+            }
+        }
+    }
 }
 
@@ -26,16 +26,19 @@
 #include "Models/Chats/ClientController.h"
 #include "bridgeifaces.h"
 #include "localization/STR_CPP.h"
+#include "Commons/DeviceDiscovery.h"
 
 void SCR_ADD_HARDWARE_SIGNER_Entry(QVariant msg) {
     Q_UNUSED(msg);
     AppModel::instance()->setNewKeySignMessage("");
     AppModel::instance()->setAddSignerStep(-1);
     AppModel::instance()->setAddSignerPercentage(0);
+    DeviceDiscovery::instance()->watch(E::STATE_ID_SCR_ADD_HARDWARE_SIGNER);
 }
 
 void SCR_ADD_HARDWARE_SIGNER_Exit(QVariant msg) {
     Q_UNUSED(msg);
+    DeviceDiscovery::instance()->unwatch();
     AppModel::instance()->setNewKeySignMessage("");
     AppModel::instance()->setAddSignerStep(-1);
     AppModel::instance()->setAddSignerPercentage(0);
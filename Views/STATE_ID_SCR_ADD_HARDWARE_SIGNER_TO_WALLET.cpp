@@ -25,6 +25,7 @@
 #include "bridgeifaces.h"
 #include "localization/STR_CPP.h"
 #include "Models/Chats/ClientController.h"
+#include "Commons/DeviceDiscovery.h"
 
 void SCR_ADD_HARDWARE_SIGNER_TO_WALLET_Entry(QVariant msg) {
     Q_UNUSED(msg);
@@ -32,10 +33,12 @@ void SCR_ADD_HARDWARE_SIGNER_TO_WALLET_Entry(QVariant msg) {
     AppModel::instance()->setAddSignerStep(-1);
     AppModel::instance()->setAddSignerPercentage(0);
     AppModel::instance()->setNewKeySignMessage("");
+    DeviceDiscovery::instance()->watch(E::STATE_ID_SCR_ADD_HARDWARE_SIGNER_TO_WALLET);
 }
 
 void SCR_ADD_HARDWARE_SIGNER_TO_WALLET_Exit(QVariant msg) {
     Q_UNUSED(msg);
+    DeviceDiscovery::instance()->unwatch();
     AppModel::instance()->setNewKeySignMessage("");
     AppModel::instance()->setAddSignerStep(-1);
     AppModel::instance()->setAddSignerPercentage(0);
@@ -27,11 +27,17 @@
 #include "Servers/Draco.h"
 
 void SCR_CREATE_TRANSACTION_Entry(QVariant msg) {
+    AppModel::instance()->registerFeedInterest("estimated_fee");
+    AppModel::instance()->registerFeedInterest("btc_rates");
+    AppModel::instance()->registerFeedInterest("exchange_rates");
     AppModel::instance()->startGetEstimatedFee();
     Q_UNUSED(msg);
 }
 
 void SCR_CREATE_TRANSACTION_Exit(QVariant msg) {
+    AppModel::instance()->unregisterFeedInterest("estimated_fee");
+    AppModel::instance()->unregisterFeedInterest("btc_rates");
+    AppModel::instance()->unregisterFeedInterest("exchange_rates");
     AppModel::instance()->setTxidReplacing("");
 }
 
@@ -34,6 +34,7 @@ void SCR_RECEIVE_Entry(QVariant msg) {
 }
 
 void SCR_RECEIVE_Exit(QVariant msg) {
+    AppModel::instance()->requestAddressBalance("");
     AppModel::instance()->setAddressBalance(0);
 }
 
@@ -74,8 +75,5 @@ void EVT_RECEIVE_DISPLAY_ADDRESS_HANDLER(QVariant msg) {
 }
 
 void EVT_RECEIVE_ADDRESS_BALANCE_HANDLER(QVariant msg) {
-    if(AppModel::instance()->walletInfo()){
-        qint64 amount = bridge::nunchukGetAddressBalance(AppModel::instance()->walletInfo()->id(), msg.toString());
-        AppModel::instance()->setAddressBalance(amount);
-    }
+    AppModel::instance()->requestAddressBalance(msg.toString());
 }
@@ -27,6 +27,9 @@
 #include "localization/STR_CPP.h"
 
 void SCR_SEND_Entry(QVariant msg) {
+    AppModel::instance()->registerFeedInterest("estimated_fee");
+    AppModel::instance()->registerFeedInterest("btc_rates");
+    AppModel::instance()->registerFeedInterest("exchange_rates");
     AppModel::instance()->setTransactionInfo(NULL);
     if(AppModel::instance()->walletInfo() && AppModel::instance()->walletInfo()->escrow()){
         AppModel::instance()->showToast(0, STR_CPP_083, EWARNING::WarningType::WARNING_MSG);
@@ -35,7 +38,9 @@ void SCR_SEND_Entry(QVariant msg) {
 }
 
 void SCR_SEND_Exit(QVariant msg) {
-
+    AppModel::instance()->unregisterFeedInterest("estimated_fee");
+    AppModel::instance()->unregisterFeedInterest("btc_rates");
+    AppModel::instance()->unregisterFeedInterest("exchange_rates");
 }
 
 void EVT_SEND_ADD_DESTINATION_REQUEST_HANDLER(QVariant msg) {
@@ -25,12 +25,15 @@
 #include "Chats/ClientController.h"
 #include "localization/STR_CPP.h"
 #include "Servers/Draco.h"
+#include "Commons/DeviceDiscovery.h"
 
 void SCR_TRANSACTION_INFO_Entry(QVariant msg) {
     AppModel::instance()->setQrExported(QStringList());
+    DeviceDiscovery::instance()->watch(E::STATE_ID_SCR_TRANSACTION_INFO);
 }
 
 void SCR_TRANSACTION_INFO_Exit(QVariant msg) {
+    DeviceDiscovery::instance()->unwatch();
 }
 
 void EVT_TRANSACTION_SIGN_REQUEST_HANDLER(QVariant msg) {
@@ -27,6 +27,7 @@
 #include "Chats/matrixbrigde.h"
 #include "Chats/ClientController.h"
 #include "Servers/Draco.h"
+#include "Commons/TransactionExport.h"
 #include "ServiceSetting.h"
 #include "Premiums/QWalletServicesTag.h"
 
@@ -145,9 +146,9 @@ void EVT_WALLET_INFO_EXPORT_CSV_HANDLER(QVariant msg) {
     QString file_path = qUtils::QGetFilePath(file);
     if(AppModel::instance()->walletInfo() && (file_path != "")){
         if(csv_type > 0 ){
-            bool ret = bridge::nunchukExportTransactionHistory(AppModel::instance()->walletInfo()->id(),
-                                                                file_path,
-                                                                nunchuk::ExportFormat::CSV);
+            // Streams on a worker; CSV or XLSX follows the chosen file extension. The screen
+            // follows it through TransactionExport's progress and finished signals.
+            bool ret = TransactionExport::instance()->start(AppModel::instance()->walletInfo()->id(), file_path);
             DBG_INFO << file_path << ret;
         }
         else{
@@ -24,6 +24,15 @@
 #include "AppSetting.h"
 #include "QEventProcessor.h"
 #include "ViewsEnums.h"
+#include <QMutex>
+#include <QHash>
+
+namespace {
+// Matrix events are immutable, so their parsed content can be shared by every reload
+QMutex                      eventContentMutex;
+QHash<QString, QJsonObject> eventContentCache;
+constexpr int               EVENT_CONTENT_CACHE_MAX = 1024;
+}
 
 QJsonObject matrixbrigde::stringToJson(const QString &content)
 {
@@ -249,9 +258,8 @@ QRoomWalletPtr matrixbrigde::ReloadRoomWallet( QNunchukRoom * const room)
             ret.data()->setWalletSigners(QWalletSignersModelPtr(new QWalletSignersModel()));
         }
         QWarningMessage msggetevt;
-        QNunchukMatrixEvent evt = GetEvent(room->id(),ret.data()->get_init_event_id(), msggetevt);
+        QJsonObject jsonObj = GetEventContent(room->id(),ret.data()->get_init_event_id(), msggetevt);
         if((int)EWARNING::WarningType::NONE_MSG == msggetevt.type()){
-            QJsonObject jsonObj = stringToJson(evt.get_content());
             ret.data()->updateWalletInfo(jsonObj);
         }
         QStringList userIds;
@@ -342,30 +350,63 @@ QRoomTransactionModelPtr matrixbrigde::GetPendingTransactions(const QString &roo
     QWarningMessage msg;
     QRoomTransactionModelPtr ret = QRoomTransactionModelPtr(new QRoomTransactionModel()) ;
     std::vector<nunchuk::RoomTransaction> results = matrixifaces::instance()->GetPendingTransactions(room_id.toStdString(), msg);
-    if((int)EWARNING::WarningType::NONE_MSG == msg.type()){
-        foreach (nunchuk::RoomTransaction room_tx, results) {
+    if((int)EWARNING::WarningType::NONE_MSG != msg.type()){
+        return ret;
+    }
+    // A wallet with several pending transactions reads its most recent history page once
+    // instead of looking each one up. The page is sized by the pending count, not by the
+    // wallet, so a large history is never read whole; anything it misses is looked up below.
+    const int BULK_MIN_PENDING = 4;
+    const int BULK_ROWS_PER_PENDING = 8;
+    const int BULK_MAX_ROWS = 200;
+    QHash<QString, int> pendingPerWallet;
+    for (const nunchuk::RoomTransaction &room_tx : results) {
+        pendingPerWallet[QString::fromStdString(room_tx.get_wallet_id())]++;
+    }
+    QHash<QString, QHash<QString, nunchuk::Transaction>> history;
+    for (auto it = pendingPerWallet.constBegin(); it != pendingPerWallet.constEnd(); ++it) {
+        if(it.value() < BULK_MIN_PENDING){
+            continue;
+        }
+        const int rows = qMin(it.value() * BULK_ROWS_PER_PENDING, BULK_MAX_ROWS);
+        QHash<QString, nunchuk::Transaction> &byTxid = history[it.key()];
+        for (const nunchuk::Transaction &tx : bridge::nunchukGetOriginTransactionHistory(it.key(), rows, 0)) {
+            byTxid.insert(QString::fromStdString(tx.get_txid()), tx);
+        }
+    }
+    QList<QRoomTransactionPtr> targets;
+    targets.reserve(static_cast<int>(results.size()));
+    for (const nunchuk::RoomTransaction &room_tx : results) {
+        const QString wallet_id = QString::fromStdString(room_tx.get_wallet_id());
+        const QString tx_id = QString::fromStdString(room_tx.get_tx_id());
+        nunchuk::Transaction tx;
+        auto bulk = history.constFind(wallet_id);
+        if(bulk != history.constEnd() && bulk.value().contains(tx_id)){
+            tx = bulk.value().value(tx_id);
+        }
+        else{
             QWarningMessage txWarning;
-            nunchuk::Transaction tx = bridge::nunchukGetOriginTransaction(QString::fromStdString(room_tx.get_wallet_id()),
-                                                                          QString::fromStdString(room_tx.get_tx_id()),
-                                                                          txWarning);
-            if((int)EWARNING::WarningType::NONE_MSG == txWarning.type()){
-                QTransactionPtr rawtx = bridge::convertTransaction(tx, QString::fromStdString(room_tx.get_wallet_id()));
-                if(rawtx){
-                    rawtx.data()->setRoomId(room_id);
-                    rawtx.data()->setInitEventId(QString::fromStdString(room_tx.get_init_event_id()));
-                    QRoomTransactionPtr target = QRoomTransactionPtr(new QRoomTransaction(room_tx));
-                    target.data()->setTransaction(rawtx);
-                    int status = (target.data()->transaction()) ? target.data()->transaction()->status() : (int)ENUNCHUCK::TransactionStatus::NETWORK_REJECTED;
-                    if(status == (int)ENUNCHUCK::TransactionStatus::PENDING_SIGNATURES
-                            || status == (int)ENUNCHUCK::TransactionStatus::READY_TO_BROADCAST
-                            || status == (int)ENUNCHUCK::TransactionStatus::PENDING_CONFIRMATION)
-                    {
-                        ret.data()->addTransaction(target);
-                    }
-                }
+            tx = bridge::nunchukGetOriginTransaction(wallet_id, tx_id, txWarning);
+            if((int)EWARNING::WarningType::NONE_MSG != txWarning.type()){
+                continue;
+            }
+        }
+        QTransactionPtr rawtx = bridge::convertTransaction(tx, wallet_id);
+        if(rawtx){
+            rawtx.data()->setRoomId(room_id);
+            rawtx.data()->setInitEventId(QString::fromStdString(room_tx.get_init_event_id()));
+            QRoomTransactionPtr target = QRoomTransactionPtr(new QRoomTransaction(room_tx));
+            target.data()->setTransaction(rawtx);
+            int status = (target.data()->transaction()) ? target.data()->transaction()->status() : (int)ENUNCHUCK::TransactionStatus::NETWORK_REJECTED;
+            if(status == (int)ENUNCHUCK::TransactionStatus::PENDING_SIGNATURES
+                    || status == (int)ENUNCHUCK::TransactionStatus::READY_TO_BROADCAST
+                    || status == (int)ENUNCHUCK::TransactionStatus::PENDING_CONFIRMATION)
+            {
+                targets.append(target);
             }
         }
     }
+    ret.data()->addTransactions(targets);
     return ret;
 }
 
@@ -456,6 +497,28 @@ QNunchukMatrixEvent matrixbrigde::GetEvent(const QString& room_id,const QString
     return QNunchukMatrixEvent(ret);
 }
 
+QJsonObject matrixbrigde::GetEventContent(const QString &room_id, const QString &event_id, QWarningMessage &msg)
+{
+    {
+        QMutexLocker locker(&eventContentMutex);
+        auto it = eventContentCache.constFind(event_id);
+        if (it != eventContentCache.constEnd()) {
+            return it.value();
+        }
+    }
+    QNunchukMatrixEvent evt = GetEvent(room_id, event_id, msg);
+    if((int)EWARNING::WarningType::NONE_MSG != msg.type()){
+        return QJsonObject();
+    }
+    QJsonObject content = stringToJson(evt.get_content());
+    QMutexLocker locker(&eventContentMutex);
+    if (eventContentCache.size() >= EVENT_CONTENT_CACHE_MAX) {
+        eventContentCache.clear();
+    }
+    eventContentCache.insert(event_id, content);
+    return content;
+}
+
 QList<QRoomWalletPtr> matrixbrigde::GetAllRoomWallets(QWarningMessage &msg)
 {
     QList<QRoomWalletPtr> ret;
@@ -468,12 +531,11 @@ QList<QRoomWalletPtr> matrixbrigde::GetAllRoomWallets(QWarningMessage &msg)
                 QNunchukRoomPtr room = CLIENT_INSTANCE->rooms()->getRoomById(room_id);
                 QRoomWalletPtr roomWallet = QRoomWalletPtr( new QRoomWallet(wallet));
                 QWarningMessage msggetevt;
-                QNunchukMatrixEvent evt = GetEvent(roomWallet.data()->get_room_id(),
-                                                   roomWallet.data()->get_init_event_id(),
-                                                   msggetevt);
+                QJsonObject jsonObj = GetEventContent(roomWallet.data()->get_room_id(),
+                                                      roomWallet.data()->get_init_event_id(),
+                                                      msggetevt);
                 if((int)EWARNING::WarningType::NONE_MSG == msggetevt.type()){
                     // Wallet info
-                    QJsonObject jsonObj = stringToJson(evt.get_content());
                     roomWallet.data()->updateWalletInfo(jsonObj);
                     //Signer info
                     QStringList userIds;
@@ -139,6 +139,10 @@ QNunchukMatrixEvent GetEvent(const QString& room_id,
                              const QString& event_id,
                              QWarningMessage& msg);
 
+QJsonObject GetEventContent(const QString& room_id,
+                            const QString& event_id,
+                            QWarningMessage& msg);
+
 void ConsumeEvent(const QString& room_id,const QNunchukMatrixEvent& event);
 
 void ConsumeSyncEvent(const QString& room_id,const QNunchukMatrixEvent& event);
@@ -1,5 +1,7 @@
 #include "Byzantine.h"
 #include "Draco.h"
+#include "Commons/OffsetPager.h"
+#include <QMutex>
 
 using namespace Command;
 Byzantine::Byzantine()
@@ -255,58 +257,63 @@ bool Byzantine::DeleteGroupWalletRequiredSignatures(const QString &wallet_id, co
 bool Byzantine::GetGroupAlerts(const QString group_id, QJsonObject &output, QString &errormsg)
 {
     if (group_id.isEmpty()) return false;
-    const int size = 20;
-    auto getAlerts = [&] (int index, QJsonArray &alert) -> bool {
-        QJsonObject data;
-        data["offset"] = QString("%1").arg(index); // Adjust offset
-        data["limit"] = QString("%1").arg(size);  // Adjust limit
-
-        int     reply_code = -1;
-        QString reply_msg  = "";
-        QString cmd = commands[Group::CMD_IDX::GROUP_WALLET_ALERTS];
-        cmd.replace("{group_id}", group_id);
-        QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
-        if(reply_code == DRACO_CODE::SUCCESSFULL){
-            QJsonObject errorObj = jsonObj["error"].toObject();
-            int response_code = errorObj["code"].toInt();
-            QString response_msg = errorObj["message"].toString();
-            if(response_code == DRACO_CODE::RESPONSE_OK){
-                QJsonObject ret = jsonObj["data"].toObject();
-                alert = ret["alerts"].toArray();
-                return true;
-            }
-            else{
-                errormsg = response_msg;
-                DBG_INFO << response_code << response_msg;
-                return false;
-            }
-        }
-        errormsg = reply_msg;
-        return false;
-    };
     QJsonArray alerts;
-    int index = 0;
-    while (true) {
-        QJsonArray alert {};
-        bool ret = getAlerts(index, alert);
-        if (ret == false) {
-            return false;
-        }
-        if (alert.isEmpty()) {
-            break;
-        }
-        for (const auto &item : alert) {
+    QString page_error = "";
+    QMutex mutex;
+    OffsetPager pager("GetGroupAlerts", [&](int offset, int limit, QJsonArray &page) {
+        QString error = "";
+        bool ret = GetGroupAlertsPage(group_id, offset, limit, page, error);
+        if (!ret) {
+            QMutexLocker locker(&mutex);
+            page_error = error;
+        }
+        return ret;
+    }, ALERTS_PAGE_SIZE);
+    bool ret = pager.run([&](const QJsonArray &page) {
+        for (const auto &item : page) {
             alerts.append(item);
         }
-        if (alert.size() < size) {
-            break;
-        }
-        index += size;
+        return true;
+    });
+    if (!ret) {
+        errormsg = page_error;
+        return false;
     }
     output["alerts"] = alerts;
     return true;
 }
 
+bool Byzantine::GetGroupAlertsPage(const QString group_id, const int offset, const int limit, QJsonArray &alerts, QString &errormsg)
+{
+    if (group_id.isEmpty()) return false;
+    QJsonObject data;
+    data["offset"] = QString("%1").arg(offset);
+    data["limit"] = QString("%1").arg(limit);
+
+    int     reply_code = -1;
+    QString reply_msg  = "";
+    QString cmd = commands[Group::CMD_IDX::GROUP_WALLET_ALERTS];
+    cmd.replace("{group_id}", group_id);
+    QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
+    if(reply_code == DRACO_CODE::SUCCESSFULL){
+        QJsonObject errorObj = jsonObj["error"].toObject();
+        int response_code = errorObj["code"].toInt();
+        QString response_msg = errorObj["message"].toString();
+        if(response_code == DRACO_CODE::RESPONSE_OK){
+            QJsonObject ret = jsonObj["data"].toObject();
+            alerts = ret["alerts"].toArray();
+            return true;
+        }
+        else{
+            errormsg = response_msg;
+            DBG_INFO << response_code << response_msg;
+            return false;
+        }
+    }
+    errormsg = reply_msg;
+    return false;
+}
+
 bool Byzantine::GetGroupAlertsCount(const QString group_id, QJsonObject &output, QString &errormsg)
 {
     if (group_id.isEmpty()) return false;
@@ -1075,7 +1082,7 @@ bool Byzantine::FinalizeDummyTransaction(const QString &group_id, const QString
     return false;
 }
 
-bool Byzantine::GetAllTransaction(const QString &group_id, const QString &wallet_id, QJsonObject &output, QString &errormsg)
+bool Byzantine::GetAllTransaction(const QString &group_id, const QString &wallet_id, JsonArrayStream::Element onTransaction, QString &errormsg)
 {
     if (group_id.isEmpty()) return false;
     int     reply_code = -1;
@@ -1090,21 +1097,17 @@ bool Byzantine::GetAllTransaction(const QString &group_id, const QString &wallet
     data["statuses"] = "PENDING_SIGNATURES,READY_TO_BROADCAST";
     data["types"] = "STANDARD,SCHEDULED,CLAIMING,ROLLOVER,RECURRING";
 
-    QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
+    QJsonObject jsonObj = getStream(cmd, data, "data/transactions", onTransaction, reply_code, reply_msg);
     if (reply_code == DRACO_CODE::SUCCESSFULL) {
         QJsonObject errorObj = jsonObj["error"].toObject();
         int response_code = errorObj["code"].toInt();
         QString response_msg = errorObj["message"].toString();
         if(response_code == DRACO_CODE::RESPONSE_OK){
-            output = jsonObj["data"].toObject();
             return true;
         }
         else {
             errormsg = response_msg;
             DBG_INFO << response_code << response_msg;
-#if 0 //NO NEED
-            AppModel::instance()->showToast(response_code, response_msg, EWARNING::WarningType::EXCEPTION_MSG);
-#endif
             return false;
         }
     }
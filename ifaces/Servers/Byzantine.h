@@ -53,6 +53,7 @@ public:
     bool DeleteGroupWalletRequiredSignatures(const QString &wallet_id, const QString &group_id, QJsonObject &output, QString &errormsg);
 
     bool GetGroupAlerts(const QString group_id, QJsonObject& output, QString &errormsg);
+    bool GetGroupAlertsPage(const QString group_id, const int offset, const int limit, QJsonArray& alerts, QString &errormsg);
     bool GetGroupAlertsCount(const QString group_id, QJsonObject& output, QString &errormsg);
     bool DismissGroupAlert(const QString group_id, const QString alert_id, QJsonObject& output, QString &errormsg);
     bool MarkGroupAlertAsRead(const QString group_id, const QString alert_id, QJsonObject& output, QString &errormsg);
@@ -92,7 +93,7 @@ public:
     bool FinalizeDummyTransaction(const QString &group_id, const QString &wallet_id, const QString &txid, QJsonObject& output, QString &errormsg);
 
     // Transaction operation
-    bool GetAllTransaction(const QString &group_id, const QString &wallet_id, QJsonObject& output, QString &errormsg);
+    bool GetAllTransaction(const QString &group_id, const QString &wallet_id, JsonArrayStream::Element onTransaction, QString &errormsg);
     bool GetAllCancelledTransaction(const QString &group_id, const QString &wallet_id, const int offset, const int limit, QJsonObject& output, QString &errormsg);
     bool GetAllTransactionNotes(const QString &group_id, const QString &wallet_id, QJsonObject& output, QString &errormsg);
     bool GetOneTransaction(const QString &group_id, const QString &wallet_id, const QString &txid, QJsonObject& output, QString &errormsg);
@@ -29,6 +29,9 @@
 #include "localization/STR_CPP.h"
 #include <QSysInfo>
 #include "ServiceSetting.h"
+#include "Commons/OffsetPager.h"
+#include "Commons/FanOut.h"
+#include <QMutex>
 
 using namespace Command;
 Draco* Draco::m_instance = NULL;
@@ -58,9 +61,23 @@ Draco *Draco::instance()
     return m_instance;
 }
 
+void Draco::runCoalesced(QAtomicInt &gate, std::function<void()> job)
+{
+    if(gate.fetchAndAddOrdered(1) > 0){
+        return;
+    }
+    QtConcurrent::run([&gate, job]() {
+        int seen = 0;
+        do {
+            seen = gate.loadAcquire();
+            job();
+        } while(!gate.testAndSetOrdered(seen, 0));
+    });
+}
+
 void Draco::refreshDevices()
 {
-    QtConcurrent::run([this]() {
+    runCoalesced(m_devicesRefresh, [this]() {
         CLIENT_INSTANCE->syncDevices(getDevices());
     });
 }
@@ -68,10 +85,18 @@ void Draco::refreshDevices()
 void Draco::refreshContacts()
 {
     if(CLIENT_INSTANCE->isNunchukLoggedIn() && (int)ENUNCHUCK::TabSelection::CHAT_TAB == AppModel::instance()->tabIndex()){
-        QtConcurrent::run([this]() {
-            CLIENT_INSTANCE->syncContacts(getContacts());
-            CLIENT_INSTANCE->syncContactsSent(getContactsSent());
-            CLIENT_INSTANCE->syncContactsReceived(getContactsReceived());
+        runCoalesced(m_contactsRefresh, [this]() {
+            FanOut::run("refreshContacts", {"contacts", "sent", "received"}, [this](const QString &list) {
+                if(list == "contacts"){
+                    CLIENT_INSTANCE->syncContacts(getContacts());
+                }
+                else if(list == "sent"){
+                    CLIENT_INSTANCE->syncContactsSent(getContactsSent());
+                }
+                else {
+                    CLIENT_INSTANCE->syncContactsReceived(getContactsReceived());
+                }
+            });
         });
     }
 }
@@ -122,12 +147,12 @@ bool Draco::getCurrencies(QJsonObject &output, QString &errormsg)
     return false;
 }
 
-void Draco::btcRates()
+bool Draco::btcRates()
 {
     QUrl url = QUrl::fromUserInput("https://api.nunchuk.io/v1/prices");
     QNetworkRequest requester_(url);
     requester_.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->get(requester_));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->get(requester_));
     QEventLoop eventLoop;
     QObject::connect(reply.get(), SIGNAL(finished()), &eventLoop, SLOT(quit()));
     eventLoop.exec();
@@ -140,19 +165,22 @@ void Draco::btcRates()
         QJsonObject btc = prices["BTC"].toObject();
         double rates_double  = btc["USD"].toDouble();
         AppModel::instance()->setBtcRates(rates_double);
+        return true;
     }
+    return false;
 }
 
-void Draco::exchangeRates(const QString &currency)
+bool Draco::exchangeRates(const QString &currency)
 {
     QUrl url = QUrl::fromUserInput("https://api.nunchuk.io/v1.1/forex/rates");
     QNetworkRequest requester_(url);
     requester_.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->get(requester_));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->get(requester_));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
-    if (reply->error() == QNetworkReply::NoError) {
+    bool ret = reply->error() == QNetworkReply::NoError;
+    if (ret) {
         QByteArray response_data = reply->readAll();
         QJsonDocument json = QJsonDocument::fromJson(response_data);
         QJsonObject jsonObj = json.object();
@@ -161,9 +189,10 @@ void Draco::exchangeRates(const QString &currency)
         AppSetting::instance()->updateUnit();
     }
     reply.release()->deleteLater();
+    return ret;
 }
 
-void Draco::feeRates()
+bool Draco::feeRates()
 {
     QUrl url;
     switch (AppSetting::instance()->primaryServer()) {
@@ -179,11 +208,12 @@ void Draco::feeRates()
     }
     QNetworkRequest requester_(url);
     requester_.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->get(requester_));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->get(requester_));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
-    if (reply->error() == QNetworkReply::NoError) {
+    bool ret = reply->error() == QNetworkReply::NoError;
+    if (ret) {
         QByteArray response_data = reply->readAll();
         QJsonDocument json = QJsonDocument::fromJson(response_data);
         QJsonObject jsonObj = json.object();
@@ -194,6 +224,7 @@ void Draco::feeRates()
         AppModel::instance()->setLasttimeCheckEstimatedFee(QDateTime::currentDateTime());
     }
     reply.release()->deleteLater();
+    return ret;
 }
 
 void Draco::verifyNewDevice(const QString &pin)
@@ -1626,7 +1657,7 @@ QJsonObject Draco::assistedWalletGetTx(const QString &wallet_id, const QString &
     return QJsonObject();
 }
 
-QJsonObject Draco::assistedWalletGetListTx(const QString &wallet_id)
+bool Draco::assistedWalletGetListTx(const QString &wallet_id, JsonArrayStream::Element onTransaction)
 {
     QJsonObject data;
     data["offset"] = "0";
@@ -1637,26 +1668,22 @@ QJsonObject Draco::assistedWalletGetListTx(const QString &wallet_id)
     QString reply_msg  = "";
     QString cmd = commands[Premium::CMD_IDX::ASSISTED_WALLET_GET_LIST_TX];
     cmd.replace("{wallet_id_or_local_id}",wallet_id);
-    QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
+    QJsonObject jsonObj = getStream(cmd, data, "data/transactions", onTransaction, reply_code, reply_msg);
     if(reply_code == DRACO_CODE::SUCCESSFULL){
         QJsonObject errorObj = jsonObj["error"].toObject();
         int response_code = errorObj["code"].toInt();
         QString response_msg = errorObj["message"].toString();
         if(response_code == DRACO_CODE::RESPONSE_OK){
-            QJsonObject data = jsonObj.value("data").toObject();
-            return data;
+            return true;
         }
         else {
             DBG_INFO << response_code << response_msg;
-#if 0 //NO NEED
-            AppModel::instance()->showToast(response_code, response_msg, EWARNING::WarningType::EXCEPTION_MSG);
-#endif
         }
     }
-    return QJsonObject();
+    return false;
 }
 
-QJsonObject Draco::assistedWalletDeleteListTx(const QString &wallet_id, const int offset, const int limit)
+bool Draco::assistedWalletDeleteListTx(const QString &wallet_id, const int offset, const int limit, QJsonObject &output, QString &errormsg)
 {
     QJsonObject data;
     data["offset"] = QString("%1").arg(offset);
@@ -1673,17 +1700,21 @@ QJsonObject Draco::assistedWalletDeleteListTx(const QString &wallet_id, const in
         int response_code = errorObj["code"].toInt();
         QString response_msg = errorObj["message"].toString();
         if(response_code == DRACO_CODE::RESPONSE_OK){
-            QJsonObject data = jsonObj.value("data").toObject();
-            return data;
+            output = jsonObj.value("data").toObject();
+            return true;
         }
         else {
             DBG_INFO << response_code << response_msg;
+            errormsg = response_msg;
 #if 0 //NO NEED
             AppModel::instance()->showToast(response_code, response_msg, EWARNING::WarningType::EXCEPTION_MSG);
 #endif
         }
     }
-    return QJsonObject();
+    else {
+        errormsg = reply_msg;
+    }
+    return false;
 }
 
 void Draco::assistedSyncTx(const QString &wallet_id, const QString &transaction_id, const QString &psbt, const QString &note)
@@ -3202,58 +3233,63 @@ bool Draco::VerifyConfirmationCode(const QString &code_id,
 bool Draco::GetAlerts(const QString wallet_id, QJsonObject &output, QString &errormsg)
 {
     if (wallet_id.isEmpty()) return false;
-    const int size = 20;
-    auto getAlerts = [&] (int index, QJsonArray &alert) -> bool {
-        QJsonObject data;
-        data["offset"] = QString("%1").arg(index); // Adjust offset
-        data["limit"] = QString("%1").arg(size);  // Adjust limit
-
-        int     reply_code = -1;
-        QString reply_msg  = "";
-        QString cmd = commands[Premium::CMD_IDX::ASSISTED_WALLET_ALERTS];
-        cmd.replace("{wallet_id_or_local_id}", wallet_id);
-        QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
-        if(reply_code == DRACO_CODE::SUCCESSFULL){
-            QJsonObject errorObj = jsonObj["error"].toObject();
-            int response_code = errorObj["code"].toInt();
-            QString response_msg = errorObj["message"].toString();
-            if(response_code == DRACO_CODE::RESPONSE_OK){
-                QJsonObject ret = jsonObj["data"].toObject();
-                alert = ret["alerts"].toArray();
-                return true;
-            }
-            else{
-                errormsg = response_msg;
-                DBG_INFO << response_code << response_msg;
-                return false;
-            }
-        }
-        errormsg = reply_msg;
-        return false;
-    };
     QJsonArray alerts;
-    int index = 0;
-    while (true) {
-        QJsonArray alert {};
-        bool ret = getAlerts(index, alert);
-        if (ret == false) {
-            return false;
-        }
-        if (alert.isEmpty()) {
-            break;
-        }
-        for (const auto &item : alert) {
+    QString page_error = "";
+    QMutex mutex;
+    OffsetPager pager("GetAlerts", [&](int offset, int limit, QJsonArray &page) {
+        QString error = "";
+        bool ret = GetAlertsPage(wallet_id, offset, limit, page, error);
+        if (!ret) {
+            QMutexLocker locker(&mutex);
+            page_error = error;
+        }
+        return ret;
+    }, ALERTS_PAGE_SIZE);
+    bool ret = pager.run([&](const QJsonArray &page) {
+        for (const auto &item : page) {
             alerts.append(item);
         }
-        if (alert.size() < size) {
-            break;
-        }
-        index += size;
+        return true;
+    });
+    if (!ret) {
+        errormsg = page_error;
+        return false;
     }
     output["alerts"] = alerts;
     return true;
 }
 
+bool Draco::GetAlertsPage(const QString wallet_id, const int offset, const int limit, QJsonArray &alerts, QString &errormsg)
+{
+    if (wallet_id.isEmpty()) return false;
+    QJsonObject data;
+    data["offset"] = QString("%1").arg(offset);
+    data["limit"] = QString("%1").arg(limit);
+
+    int     reply_code = -1;
+    QString reply_msg  = "";
+    QString cmd = commands[Premium::CMD_IDX::ASSISTED_WALLET_ALERTS];
+    cmd.replace("{wallet_id_or_local_id}", wallet_id);
+    QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
+    if(reply_code == DRACO_CODE::SUCCESSFULL){
+        QJsonObject errorObj = jsonObj["error"].toObject();
+        int response_code = errorObj["code"].toInt();
+        QString response_msg = errorObj["message"].toString();
+        if(response_code == DRACO_CODE::RESPONSE_OK){
+            QJsonObject ret = jsonObj["data"].toObject();
+            alerts = ret["alerts"].toArray();
+            return true;
+        }
+        else{
+            errormsg = response_msg;
+            DBG_INFO << response_code << response_msg;
+            return false;
+        }
+    }
+    errormsg = reply_msg;
+    return false;
+}
+
 bool Draco::GetAlertsCount(const QString wallet_id, QJsonObject &output, QString &errormsg)
 {
     QJsonObject data;
@@ -4198,57 +4234,61 @@ bool Draco::DraftWalletDismissAnAlert(const QString alert_id, QJsonObject &outpu
 
 bool Draco::DraftWalletGetAlerts(QJsonObject &output, QString &errormsg)
 {
-    const int size = 20;
-    auto getAlerts = [&] (int index, QJsonArray &alert) -> bool {
-        QJsonObject data;
-        data["offset"] = QString("%1").arg(index); // Adjust offset
-        data["limit"] = QString("%1").arg(size);  // Adjust limit
-
-        int     reply_code = -1;
-        QString reply_msg  = "";
-        QString cmd = commands[Premium::CMD_IDX::DRAFT_WALLET_GET_ALERTS];
-        QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
-        if(reply_code == DRACO_CODE::SUCCESSFULL){
-            QJsonObject errorObj = jsonObj["error"].toObject();
-            int response_code = errorObj["code"].toInt();
-            QString response_msg = errorObj["message"].toString();
-            if(response_code == DRACO_CODE::RESPONSE_OK){
-                QJsonObject ret = jsonObj["data"].toObject();
-                alert = ret["alerts"].toArray();
-                return true;
-            }
-            else{
-                errormsg = response_msg;
-                DBG_INFO << response_code << response_msg;
-                return false;
-            }
-        }
-        errormsg = reply_msg;
-        return false;
-    };
     QJsonArray alerts;
-    int index = 0;
-    while (true) {
-        QJsonArray alert {};
-        bool ret = getAlerts(index, alert);
-        if (ret == false) {
-            return false;
-        }
-        if (alert.isEmpty()) {
-            break;
-        }
-        for (const auto &item : alert) {
+    QString page_error = "";
+    QMutex mutex;
+    OffsetPager pager("DraftWalletGetAlerts", [&](int offset, int limit, QJsonArray &page) {
+        QString error = "";
+        bool ret = DraftWalletGetAlertsPage(offset, limit, page, error);
+        if (!ret) {
+            QMutexLocker locker(&mutex);
+            page_error = error;
+        }
+        return ret;
+    }, ALERTS_PAGE_SIZE);
+    bool ret = pager.run([&](const QJsonArray &page) {
+        for (const auto &item : page) {
             alerts.append(item);
         }
-        if (alert.size() < size) {
-            break;
-        }
-        index += size;
+        return true;
+    });
+    if (!ret) {
+        errormsg = page_error;
+        return false;
     }
     output["alerts"] = alerts;
     return true;
 }
 
+bool Draco::DraftWalletGetAlertsPage(const int offset, const int limit, QJsonArray &alerts, QString &errormsg)
+{
+    QJsonObject data;
+    data["offset"] = QString("%1").arg(offset);
+    data["limit"] = QString("%1").arg(limit);
+
+    int     reply_code = -1;
+    QString reply_msg  = "";
+    QString cmd = commands[Premium::CMD_IDX::DRAFT_WALLET_GET_ALERTS];
+    QJsonObject jsonObj = getSync(cmd, data, reply_code, reply_msg);
+    if(reply_code == DRACO_CODE::SUCCESSFULL){
+        QJsonObject errorObj = jsonObj["error"].toObject();
+        int response_code = errorObj["code"].toInt();
+        QString response_msg = errorObj["message"].toString();
+        if(response_code == DRACO_CODE::RESPONSE_OK){
+            QJsonObject ret = jsonObj["data"].toObject();
+            alerts = ret["alerts"].toArray();
+            return true;
+        }
+        else{
+            errormsg = response_msg;
+            DBG_INFO << response_code << response_msg;
+            return false;
+        }
+    }
+    errormsg = reply_msg;
+    return false;
+}
+
 bool Draco::DraftWalletGetAlertsCount(QJsonObject &output, QString &errormsg)
 {
     QJsonObject data;
@@ -30,6 +30,8 @@
 #include "Chats/ClientController.h"
 #include "DracoDefines.h"
 #include "QRest.h"
+#include <QAtomicInt>
+#include <functional>
 
 class Draco : public QRest
 {
@@ -55,8 +57,8 @@ public:
     Q_INVOKABLE void createAccount(const QString& name, const QString& email);
     Q_INVOKABLE void singin(const QString &email, const QString &password);
     Q_INVOKABLE bool signout();
-    void exchangeRates(const QString &currency);
-    Q_INVOKABLE void feeRates();
+    bool exchangeRates(const QString &currency);
+    Q_INVOKABLE bool feeRates();
     Q_INVOKABLE void verifyNewDevice(const QString &pin);
     Q_INVOKABLE void resendVerifyNewDeviceCode();
     Q_INVOKABLE void inviteFriends(const QStringList& emails);
@@ -126,8 +128,8 @@ public:
     QJsonObject assistedWalletSignTx(const QString &wallet_id, const QString &transaction_id, const QString &psbt, const QString &memo);
     bool assistedWalletCancelTx(const QString &wallet_id, const QString &transaction_id);
     QJsonObject assistedWalletGetTx(const QString &wallet_id, const QString &transaction_id);
-    QJsonObject assistedWalletGetListTx(const QString &wallet_id);
-    QJsonObject assistedWalletDeleteListTx(const QString &wallet_id, const int offset, const int limit);
+    bool assistedWalletGetListTx(const QString &wallet_id, JsonArrayStream::Element onTransaction);
+    bool assistedWalletDeleteListTx(const QString &wallet_id, const int offset, const int limit, QJsonObject &output, QString &errormsg);
     void assistedSyncTx(const QString &wallet_id, const QString &transaction_id, const QString &psbt, const QString &note);
     bool assistedRbfTx(const QString &wallet_id, const QString &transaction_id, const QString &psbt, QJsonObject &output, QString &errormsg);
     bool assistedWalletGetListKey(QJsonObject &output, QString &errormsg);
@@ -228,7 +230,7 @@ public:
                                 QString& errormsg);
 
     bool getCurrencies(QJsonObject& output, QString& errormsg);
-    void btcRates();
+    bool btcRates();
 
     bool inheritanceDownloadBackup(const QString& magic,
                                    const QStringList &backup_passwords,
@@ -325,6 +327,7 @@ public:
                                 QString &errormsg);
 
     bool GetAlerts(const QString wallet_id, QJsonObject &output, QString &errormsg);
+    bool GetAlertsPage(const QString wallet_id, const int offset, const int limit, QJsonArray &alerts, QString &errormsg);
     bool GetAlertsCount(const QString wallet_id, QJsonObject &output, QString &errormsg);
     bool DismissAlert(const QString wallet_id, const QString alert_id, QJsonObject &output, QString &errormsg);
     bool MarkAlertAsRead(const QString wallet_id, const QString alert_id, QJsonObject &output, QString &errormsg);
@@ -420,6 +423,7 @@ public:
     bool DraftWalletMarkAnAlertAsRead(const QString alert_id, QJsonObject &output, QString &errormsg);
     bool DraftWalletDismissAnAlert(const QString alert_id, QJsonObject &output, QString &errormsg);
     bool DraftWalletGetAlerts(QJsonObject &output, QString &errormsg);
+    bool DraftWalletGetAlertsPage(const int offset, const int limit, QJsonArray &alerts, QString &errormsg);
     bool DraftWalletGetAlertsCount(QJsonObject &output, QString &errormsg);
     bool DraftWalletSetServerKey(const QString &server_key_id, QJsonObject &output, QString &errormsg);
     bool DraftWalletRequestAddKey(QJsonObject &output, QString &errormsg);
@@ -432,6 +436,10 @@ private:
     Draco();
     ~Draco();
     static Draco* m_instance;
+    // Runs job on the pool unless it is already running; triggers that arrive meanwhile fold into one more pass
+    void runCoalesced(QAtomicInt &gate, std::function<void()> job);
+    QAtomicInt m_contactsRefresh {0};
+    QAtomicInt m_devicesRefresh {0};
     QString m_uid;
     QString m_pid;
     QString m_emailRequested;
@@ -0,0 +1,377 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+#include "DracoDefines.h"
+#include <QReadWriteLock>
+#include <QVector>
+
+const EndpointTable commands {};
+
+namespace {
+const QMap<int, QString> &endpointTemplates()
+{
+    static const QMap<int, QString> templates {
+        { Common::CMD_IDX::CREATE_ACCOUNT               , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("register")             },
+        { Common::CMD_IDX::ACCOUNT_AVAILABILITY         , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("username-availability")},
+        { Common::CMD_IDX::SIGNIN                       , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("sign-in")              },
+        { Common::CMD_IDX::SIGNOUT                      , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("log-out")              },
+        { Common::CMD_IDX::RECOVER_PASSWORD             , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("recover-password")     },
+        { Common::CMD_IDX::FORGOT_PASSWORD              , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("forgot-password")      },
+        { Common::CMD_IDX::CHANGE_PASSWORD              , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("change-password")      },
+        { Common::CMD_IDX::RESEND_PASSWORD              , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("resend-password")      },
+        { Common::CMD_IDX::VERIFY_NEW_DEVICE            , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("sign-in/verify-new-device")},
+        { Common::CMD_IDX::RESEND_VERIFY_NEW_DEVICE_CODE, QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("sign-in/resend-verify-new-device-code")},
+        { Common::CMD_IDX::INVITE_FRIEND                , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("invite")               },
+        { Common::CMD_IDX::GET_ME                       , QString("%1/%2").arg(DRAGON_USER_URL).arg("me")                       },
+        { Common::CMD_IDX::SEARCH_FRIEND                , QString("%1/%2").arg(DRAGON_USER_URL).arg("search")                   },
+        { Common::CMD_IDX::SEARCH_FRIEND_LIST           , QString("%1/%2").arg(DRAGON_USER_URL).arg("auto-complete-search")     },
+        { Common::CMD_IDX::REQUEST_FRIEND               , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/request")         },
+        { Common::CMD_IDX::REQUEST_FRIEND_LIST          , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/request")         },
+        { Common::CMD_IDX::CANCEL_REQUEST_FRIEND        , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/request")         },
+        { Common::CMD_IDX::IGNORE_FRIEND_REQUEST        , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/request")         },
+        { Common::CMD_IDX::GET_FRIENDS_SENT             , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/request/sent")    },
+        { Common::CMD_IDX::GET_FRIENDS_RECEIVED         , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/request/received")},
+        { Common::CMD_IDX::GET_FRIENDS_LIST             , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/")                },
+        { Common::CMD_IDX::REMOVE_FRIEND                , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/")                },
+        { Common::CMD_IDX::ACCEPT_FRIEND_REQUEST        , QString("%1/%2").arg(DRAGON_USER_URL).arg("contacts/accept")          },
+        { Common::CMD_IDX::GET_ROOM_MEMBERS             , QString("%1/%2").arg(DRAGON_CHAT_URL).arg("rooms")                    },
+        { Common::CMD_IDX::DELETE_ACCOUNT               , QString("%1/%2").arg(DRAGON_USER_URL).arg("me")                       },
+        { Common::CMD_IDX::DELETE_CONFIRM               , QString("%1/%2").arg(DRAGON_USER_URL).arg("me/delete-confirmation")   },
+        { Common::CMD_IDX::GET_DEVICES_LIST             , QString("%1/%2").arg(DRAGON_USER_URL).arg("devices/")                 },
+        { Common::CMD_IDX::USER_PROFILE                 , QString("%1/%2").arg(DRAGON_USER_URL).arg("me")                       },
+        { Common::CMD_IDX::CHECK_FOR_UPDATE             , QString("%1/%2").arg(DRAGON_APP_URL).arg("check-for-update")          },
+        { Common::CMD_IDX::DEVICE_MARK_COMPROMISED      , QString("%1/%2").arg(DRAGON_USER_URL).arg("devices/mark-compromised") },
+        { Common::CMD_IDX::DEVICE_SIGNOUT               , QString("%1/%2").arg(DRAGON_USER_URL).arg("devices/")                  },
+        { Common::CMD_IDX::DEVICE_ALL_SIGNOUT           , QString("%1/%2").arg(DRAGON_USER_URL).arg("devices/__all")              },
+        { Common::CMD_IDX::VERIFY_DELETE_DEVICES        , QString("%1/%2").arg(DRAGON_USER_URL).arg("devices/verify-delete-devices")},
+        { Common::CMD_IDX::GET_ELECTRUM_SERVERS         , QString("%1/%2").arg(DRAGON_APP_URL).arg("electrum")                  },
+        { PrimaryKey::CMD_IDX::PRIMARY_KEY_SIGNUP           , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("pkey/signup") },
+        { PrimaryKey::CMD_IDX::PRIMARY_KEY_SIGNIN           , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("pkey/signin") },
+        { PrimaryKey::CMD_IDX::PRIMARY_KEY_NONCE            , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("pkey/nonce")  },
+        { PrimaryKey::CMD_IDX::PRIMARY_KEY_USERNAME         , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("username-availability/")  },
+        { PrimaryKey::CMD_IDX::PRIMARY_KEY_PUBLIC_ADDRESS   , QString("%1/%2").arg(DRAGON_USER_URL).arg("pkey/")  },
+        { PrimaryKey::CMD_IDX::PRIMARY_KEY_DELETE_CONFIRMTION, QString("%1/%2").arg(DRAGON_USER_URL).arg("pkey/delete-confirmation")  },
+        { PrimaryKey::CMD_IDX::PRIMARY_KEY_CHANGE_KEY       , QString("%1/%2").arg(DRAGON_USER_URL).arg("pkey/change-pkey")  },
+
+        // USER_SUBSCRIPTION
+        { Common::CMD_IDX::USER_SUBCRIPTIONS_CURRENT    , QString("%1/%2").arg(DRAGON_SUBSCRIPTIONS_URL).arg("current")  },
+        { Common::CMD_IDX::USER_SUBCRIPTIONS_TESTNET    , QString("%1/%2").arg(DRAGON_SUBSCRIPTIONS_URL).arg("testnet")  },
+        { Common::CMD_IDX::USER_SUBCRIPTIONS_STATUS             , QString("%1/%2").arg(DRAGON_SUBSCRIPTIONS_URL).arg("status")  },
+        { Common::CMD_IDX::USER_SUBCRIPTIONS_STATUS_TESTNET     , QString("%1/%2").arg(DRAGON_SUBSCRIPTIONS_URL).arg("status-testnet")  },
+
+        // ASSISTED_WALLETS
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets")  },
+        { Premium::CMD_IDX::ASSISTED_WALLET_CREATE_TX    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions")  },
+        { Premium::CMD_IDX::ASSISTED_WALLET_UPDATE_TX    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions/{transaction_id}")  },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_LIST_TX  , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions")  },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_LIST_TX_NOTES  , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions/notes")  },
+        { Premium::CMD_IDX::ASSISTED_WALLET_DELETE_LIST_TX     , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions")  },
+        { Premium::CMD_IDX::ASSISTED_WALLET_SIGN_TX      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/sign") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_CANCEL_TX    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions/{transaction_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_TX       , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions/{transaction_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_SYNC_TX      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/sync") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_RBF_TX       , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/rbf") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_ADD_KEY      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/add-key") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_LIST_KEY , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/request-add-key") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_REMOVE_ID    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/request-add-key/{request_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_CONFIG   , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("configs") },
+        { Premium::CMD_IDX::ASSISTED_KEY_UPDATE_NAME     , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallet-keys/{xfp}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_INFO     , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_UPDATE_NAME  , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_REMOVE_WALLET, QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_REMOVE_WALLET_REQUIRED_SIGNATURES, QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/calculate-required-signatures") },
+
+        // SEC_QUES
+        { Premium::CMD_IDX::SEC_QUES_GET                 , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("security-questions") },
+        { Premium::CMD_IDX::SEC_QUES_SET                 , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("security-questions") },
+        { Premium::CMD_IDX::SEC_QUES_CREATE              , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("security-questions") },
+        { Premium::CMD_IDX::SEC_QUES_UPDATE              , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("security-questions/update") },
+        { Premium::CMD_IDX::SEC_QUES_VERIFY_ANSWER       , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("security-questions/verify-answer") },
+        { Premium::CMD_IDX::SEC_QUES_REQUIRED_SIGNATURES , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("security-questions/calculate-required-signatures") },
+
+        // LOCK_DOWN
+        { Premium::CMD_IDX::LOCKDOWN_SET_ANSWER_SECURITY_QUESTION      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("lockdown/lock") },
+        { Premium::CMD_IDX::LOCKDOWN_SET_SIGN_DUMMY_TX                 , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("lockdown/lock") },
+        { Premium::CMD_IDX::LOCKDOWN_REQUIRED_SIGNATURES , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("lockdown/calculate-required-signatures") },
+        { Premium::CMD_IDX::LOCKDOWN_GET_PERIOD          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("lockdown/period") },
+
+        //USER_WALLET
+        { Premium::CMD_IDX::GET_RANDOM_NONCE             , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("nonce") },
+        { Common::CMD_IDX::VERIFY_PASSWORD_TOKEN        , QString("%1/%2").arg(DRAGON_PASSPORT_URL).arg("verified-password-token")  },
+
+        //USER_KEYS
+        { Premium::CMD_IDX::USER_KEYS_MARK_A_KEY_AS_VERIFIED,        QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/{key_id_or_xfp}/verify") },
+        { Premium::CMD_IDX::USER_KEYS_REQUEST_RECOVERY_KEY,          QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/{key_id_or_xfp}/request-recover") },
+        { Premium::CMD_IDX::USER_KEYS_RECOVERY_KEY,                  QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/{key_id_or_xfp}/recover") },
+        { Premium::CMD_IDX::USER_KEYS_MARK_RECOVER_STATUS,           QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/{key_id_or_xfp}/mark-recover-status") },
+        { Premium::CMD_IDX::USER_KEYS_DOWNLOAD_BACKUP,               QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/{key_id_or_xfp}/download-backup") },
+        { Premium::CMD_IDX::USER_KEYS_CALCULATE_REQUIRED_SIGNATURES, QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/{key_id_or_xfp}/calculate-required-signatures") },
+        { Premium::CMD_IDX::USER_KEYS_UPLOAD_BACKUP,                 QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/upload-backup") },
+        { Premium::CMD_IDX::USER_KEYS_GET_LIST_USER_KEYS,            QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys") },
+        { Premium::CMD_IDX::USER_KEYS_GET_USER_KEY,                  QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("user-keys/{key_id_or_xfp}") },
+
+        //INHERITANCE
+        { Premium::CMD_IDX::INHERITANCE_DOWNLOAD_BACKUP  , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/claiming/download-backups") },
+        { Premium::CMD_IDX::INHERITANCE_CLAIM_REQUEST    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/claiming/claim") },
+        { Premium::CMD_IDX::INHERITANCE_CLAIM_STATUS     , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/claiming/status") },
+        { Premium::CMD_IDX::INHERITANCE_CREATE_TX        , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/claiming/create-transaction") },
+        { Premium::CMD_IDX::INHERITANCE_CHECK            , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/check") },
+        { Premium::CMD_IDX::INHERITANCE_GET_PLAN         , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance") },
+        { Premium::CMD_IDX::INHERITANCE_FAKE_UPDATE      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/fake-update") },
+        { Premium::CMD_IDX::INHERITANCE_PLAN_REQUIRED_SIGNATURES      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/calculate-required-signatures") },
+        { Premium::CMD_IDX::INHERITANCE_PLAN_UPDATE      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance") },
+        { Premium::CMD_IDX::INHERITANCE_PLAN_CREATE      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance") },
+        { Premium::CMD_IDX::INHERITANCE_PLAN_CANCEL      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance") },
+        { Premium::CMD_IDX::INHERITANCE_PLAN_BUFFER_PERIODS , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/buffer-period") },
+        { Premium::CMD_IDX::INHERITANCE_REQUEST_PLANING_DENY,    QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/request-planning/{request_id}/deny") },
+        { Premium::CMD_IDX::INHERITANCE_REQUEST_PLANING_APPROVE, QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("inheritance/request-planning/{request_id}/approve") },
+
+        //SERVER_KEYS /v1.1/user-wallets/server-keys/{key_id_or_xfp}
+        { Premium::CMD_IDX::SERVER_KEYS_GET              , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("server-keys/{key_id_or_xfp}") },
+        { Premium::CMD_IDX::SERVER_KEYS_UPDATE           , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("server-keys/{key_id_or_xfp}") },
+        { Premium::CMD_IDX::SERVER_KEYS_REQUIRED_SIGNATURES, QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("server-keys/{key_id_or_xfp}/calculate-required-signatures") },
+
+        { Premium::CMD_IDX::GET_CURRENCIES               , QString("%1/%2").arg(DRAGON_FOREX_URL).arg("currencies") },
+
+        { Premium::CMD_IDX::ASSISTED_WALLET_ALERTS               , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/alerts") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_ALERTS_COUNT         , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/alerts/total") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_ALERTS_READ          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/alerts/{alert_id}/mark-as-read") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_ALERTS_DISMISS       , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/alerts/{alert_id}/dismiss") },
+
+        // Wallet health check
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_KEY_HEALTH_REMINDER             , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/health/reminder") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_ADD_OR_UPDATE_KEY_HEALTH_REMINDER   , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/health/reminder") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_DELETE_KEY_HEALTH_REMINDER          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/health/reminder") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_SKIP_KEY_HEALTH_REMINDER            , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/health/reminder/{xfp}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_HEALTHCHECK        , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/health/{xfp}/health-check") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_HEALTH         , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/health") },
+
+        //Dummy transaction
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_DUMMY_TX       , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_UPDATE_DUMMY_TX    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_CANCEL_DUMMY_TX    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_FINALIZE_DUMMY_TX  , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}/finalize") },
+
+        { Premium::CMD_IDX::ASSISTED_WALLET_HEALTH_CHECK_HISTORY_GET  , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallet-keys/{xfp}/history") },
+
+        { Premium::CMD_IDX::COUNTRY_CODE_LIST             , QString("%1/%2").arg(DRAGON_BANNERS_URL).arg("onboarding/countries") },
+        { Premium::CMD_IDX::ONBOARDING_NO_ADVISOR         , QString("%1/%2").arg(DRAGON_BANNERS_URL).arg("onboarding/no-advisor") },
+        { Premium::CALCULATE_REQUIRED_SIGNATURES_FOR_CHANGING_EMAIL , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("email-change/calculate-required-signatures") },
+        { Premium::CHANGING_EMAIL                                   , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("email-change/change") },
+
+        // Replace Wallet
+        { Premium::CMD_IDX::ASSISTED_WALLET_CONFIGURE_WALLET_REPLACEMENT    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/replacement/configs") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_INITIATE_KEY_REPLACEMENT        , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/replacement/{xfp}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_CANCEL_KEY_REPLACEMENT          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/replacement/{xfp}") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_REPLACE_KEY                     , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/replacement/{xfp}/replace") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_FINALIZE_KEY_REPLACEMENT        , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/replacement/finalize") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_STATUS_KEY_REPLACEMENT      , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/replacement/status") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_RESET_KEY_REPLACEMENT           , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("wallets/{wallet_id_or_local_id}/replacement/reset") },
+
+        // Draft Wallet
+        { Premium::CMD_IDX::DRAFT_WALLET_MARK_ALERT_AS_READ            , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/current/alerts/{alert_id}/mark-as-read") },
+        { Premium::CMD_IDX::DRAFT_WALLET_DISMISS_ALERT                 , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/current/alerts/{alert_id}/dismiss") },
+        { Premium::CMD_IDX::DRAFT_WALLET_GET_ALERTS                    , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/current/alerts") },
+        { Premium::CMD_IDX::DRAFT_WALLET_GET_TOTAL_ALERTS              , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/current/alerts/total") },
+        { Premium::CMD_IDX::DRAFT_WALLET_SET_SERVER_KEY                , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/set-server-key") },
+        { Premium::CMD_IDX::DRAFT_WALLET_REQUEST_ADD_KEY               , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/request-add-key") },
+        { Premium::CMD_IDX::DRAFT_WALLET_PUSH_REQUEST_ADD_KEY          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/request-add-key/{request_id}/push") },
+        { Premium::CMD_IDX::DRAFT_WALLET_INIT                          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/init") },
+        { Premium::CMD_IDX::DRAFT_WALLET_GET_REQUEST_ADD_KEY           , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/request-add-key/{request_id}") },
+        { Premium::CMD_IDX::DRAFT_WALLET_GET_CURRENT                   , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/current") },
+        { Premium::CMD_IDX::DRAFT_WALLET_RESET_CURRENT                 , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("draft-wallets/current") },
+
+        //DRAGON_GROUP_WALLETS
+        { Group::CMD_IDX::GROUP_WALLET_LIST_WALLETS         , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("wallets") },
+        { Group::CMD_IDX::GROUP_WALLETS_ONE                 , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_LIST                , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups") },
+        { Group::CMD_IDX::GROUP_WALLETS_ACCEPT              , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/members/accept") },
+        { Group::CMD_IDX::GROUP_WALLETS_DENY                , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/members/deny") },
+        { Group::CMD_IDX::GROUP_WALLET_EDIT_GROUP_MEMBERS                       , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/members") },
+        { Group::CMD_IDX::GROUP_WALLET_EDIT_GROUP_MEMBERS_REQUIRED_SIGNATURES   , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/members/calculate-requires-signatures") },
+
+
+        { Group::CMD_IDX::GROUP_WALLET_ALERTS               , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/alerts") },
+        { Group::CMD_IDX::GROUP_WALLET_ALERTS_COUNT         , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/alerts/total") },
+        { Group::CMD_IDX::GROUP_WALLET_ALERTS_READ          , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/alerts/{alert_id}/mark-as-read") },
+        { Group::CMD_IDX::GROUP_WALLET_ALERTS_DISMISS       , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/alerts/{alert_id}/dismiss") },
+        { Group::CMD_IDX::GROUP_WALLETS_ALL_PERMISSION      , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("permissions") },
+        { Group::CMD_IDX::GROUP_WALLETS_ONE_PERMISSION      , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("permissions/{slug}") },
+        { Group::CMD_IDX::GROUP_WALLETS_DEFAULT_PERMISSION  , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("permissions/default") },
+        { Group::CMD_IDX::GROUP_WALLETS_GET_CURRENT         , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/current") },
+        { Group::CMD_IDX::GROUP_WALLET_REMOVE_WALLET        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}") },
+        { Group::CMD_IDX::GROUP_WALLET_REMOVE_WALLET_REQUIRED_SIGNATURES, QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/calculate-required-signatures") },
+        { Group::CMD_IDX::GROUP_WALLET_GET_ALIAS            , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/alias") },
+        { Group::CMD_IDX::GROUP_WALLET_UPDATE_ALIAS         , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/alias") },
+        { Group::CMD_IDX::GROUP_WALLET_DELETE_ALIAS         , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/alias") },
+        { Group::CMD_IDX::GROUP_WALLET_UPDATE_PRIMARY_OWNER , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/primary-owner") },
+
+        { Group::CMD_IDX::GROUP_DRAFT_WALLETS_ADD_KEY               , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/draft-wallets/add-key") },
+        { Group::CMD_IDX::GROUP_DRAFT_WALLETS_GET_CURRENT           , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/draft-wallets/current") },
+        { Group::CMD_IDX::GROUP_DRAFT_WALLETS_RESET_CURRENT         , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/draft-wallets/current") },
+        { Group::CMD_IDX::GROUP_DRAFT_WALLETS_REQUEST_ADD_KEY       , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/draft-wallets/request-add-key") },
+        { Group::CMD_IDX::GROUP_DRAFT_WALLETS_DELETE_REQUEST_ADD_KEY, QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/draft-wallets/request-add-key/{request_id}") },
+        { Group::CMD_IDX::GROUP_WALLET_UPDATE_WALLET                , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}") },
+
+        // Group wallet health check
+        { Group::CMD_IDX::GROUP_WALLETS_GET_KEY_HEALTH_REMINDER             , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/health/reminder") },
+        { Group::CMD_IDX::GROUP_WALLETS_ADD_OR_UPDATE_KEY_HEALTH_REMINDER   , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/health/reminder") },
+        { Group::CMD_IDX::GROUP_WALLETS_DELETE_KEY_HEALTH_REMINDER          , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/health/reminder") },
+        { Group::CMD_IDX::GROUP_WALLETS_SKIP_KEY_HEALTH_REMINDER            , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/health/reminder/{xfp}") },
+        { Group::CMD_IDX::GROUP_WALLETS_REQUEST_HEALTHCHECK, QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/health/{xfp}/request-health-check") },
+        { Group::CMD_IDX::GROUP_WALLETS_HEALTHCHECK        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/health/{xfp}/health-check") },
+        { Group::CMD_IDX::GROUP_WALLETS_GET_HEALTH         , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/health") },
+
+        //Dummy transaction
+        { Group::CMD_IDX::GROUP_WALLETS_GET_DUMMY_TX       , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_UPDATE_DUMMY_TX    , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_CANCEL_DUMMY_TX    , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_FINALIZE_DUMMY_TX  , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/dummy-transactions/{dummy_transaction_id}/finalize") },
+
+        // Group transactions
+        { Group::CMD_IDX::GROUP_WALLETS_GET_ALL_TX           , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions") },
+        { Group::CMD_IDX::GROUP_WALLETS_GET_ALL_TX_NOTES     , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/notes") },
+        { Group::CMD_IDX::GROUP_WALLETS_GET_ONE_TX           , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_UPDATE_TX            , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_CANCEL_TX            , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_SYNC_TX              , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/sync") },
+        { Group::CMD_IDX::GROUP_WALLETS_SIGN_TX              , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/sign") },
+        { Group::CMD_IDX::GROUP_WALLETS_CREATE_TX            , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions") },
+        { Group::CMD_IDX::GROUP_WALLETS_SCHEDULE_TX          , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/schedule") },
+        { Group::CMD_IDX::GROUP_WALLETS_CANCEL_SCHEDULE_TX   , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/schedule") },
+        { Group::CMD_IDX::GROUP_WALLETS_REQUEST_SIGNATURE_TX , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/request-signature") },
+        { Group::CMD_IDX::GROUP_WALLETS_RBF_TX              , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/transactions/{transaction_id}/rbf") },
+
+        // Group server-keys
+        { Group::CMD_IDX::SERVER_KEYS_GET     , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/server-keys/{key_id_or_xfp}") },
+        { Group::CMD_IDX::SERVER_KEYS_UPDATE  , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/server-keys/{key_id_or_xfp}") },
+        { Group::CMD_IDX::SERVER_KEYS_REQUIRED_SIGNATURES , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/server-keys/{key_id_or_xfp}/calculate-required-signatures") },
+
+        { Group::CMD_IDX::LOCKDOWN_GET_PERIOD                   , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("lockdown/period") },
+        { Group::CMD_IDX::LOCKDOWN_REQUIRED_SIGNATURES          , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("lockdown/calculate-required-signatures") },
+        { Group::CMD_IDX::LOCKDOWN_SET_ANSWER_SECURITY_QUESTION , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("lockdown/lock") },
+        { Group::CMD_IDX::LOCKDOWN_SET_SIGN_DUMMY_TX            , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("lockdown/lock") },
+        { Group::CMD_IDX::LOCKDOWN_SET_CONFIRMATION_CODE        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("lockdown/lock") },
+
+        { Group::CMD_IDX::ASSISTED_WALLET_GET_CONFIG            , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("configs") },
+
+        { Premium::CMD_IDX::CONFIRMATION_CODE                 , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("confirmation-code") },
+        { Premium::CMD_IDX::VERIFY_CONFIRMATION_CODE          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("confirmation-code/{code_id}/verify") },
+
+        // Group chat
+        { Group::CMD_IDX::GROUP_WALLETS_CHAT_GET           , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("chat/{group_id}/current") },
+        { Group::CMD_IDX::GROUP_WALLETS_CHAT_UPDATE        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("chat/{group_id}/current") },
+        { Group::CMD_IDX::GROUP_WALLETS_CHAT_DELETE        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("chat/{group_id}/current") },
+        { Group::CMD_IDX::GROUP_WALLETS_CHAT_CREATE        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("chat/{group_id}") },
+        { Group::CMD_IDX::GROUP_WALLETS_CHAT_GET_ALL       , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("chat") },
+        { Group::CMD_IDX::GROUP_WALLETS_CHAT_GET_HISTORY_PERIODS , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("chat/settings/history-periods") },
+
+        // Recurring payment
+        { Group::CMD_IDX::GROUP_WALLET_RECURRING_PAYMENT_LIST    , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/recurring-payment") },
+        { Group::CMD_IDX::GROUP_WALLET_RECURRING_PAYMENT_CREATE  , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/recurring-payment") },
+        { Group::CMD_IDX::GROUP_WALLET_RECURRING_PAYMENT_GET     , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/recurring-payment/{recurring_payment_id}") },
+        { Group::CMD_IDX::GROUP_WALLET_RECURRING_PAYMENT_CANCEL  , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/recurring-payment/{recurring_payment_id}") },
+
+        // Replace Wallet
+        { Group::CMD_IDX::GROUP_WALLET_CONFIGURE_WALLET_REPLACEMENT    , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/replacement/configs") },
+        { Group::CMD_IDX::GROUP_WALLET_INITIATE_KEY_REPLACEMENT        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/replacement/{xfp}") },
+        { Group::CMD_IDX::GROUP_WALLET_CANCEL_KEY_REPLACEMENT          , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/replacement/{xfp}") },
+        { Group::CMD_IDX::GROUP_WALLET_REPLACE_KEY                     , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/replacement/{xfp}/replace") },
+        { Group::CMD_IDX::GROUP_WALLET_FINALIZE_KEY_REPLACEMENT        , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/replacement/finalize") },
+        { Group::CMD_IDX::GROUP_WALLET_GET_STATUS_KEY_REPLACEMENT      , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/replacement/status") },
+        { Group::CMD_IDX::GROUP_WALLET_RESET_KEY_REPLACEMENT           , QString("%1/%2").arg(DRAGON_GROUP_WALLETS_URL).arg("groups/{group_id}/wallets/{wallet_id_or_local_id}/replacement/reset") },
+
+        // Saved addresses
+        { Premium::CMD_IDX::ASSISTED_WALLET_GET_SAVED_ADDRESSES        , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("saved-address") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_ADD_SAVED_ADDRESS          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("saved-address") },
+        { Premium::CMD_IDX::ASSISTED_WALLET_DELETE_SAVED_ADDRESS       , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("saved-address/{address}") },
+
+        { Premium::CMD_IDX::SIGN_DUMMY_TRANSACTION_TO_SIGN_IN          , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("signin-dummy/{dummy_transaction_id}") },
+        { Premium::CMD_IDX::SIGN_IN_USING_XPUB_WALLET                  , QString("%1/%2").arg(DRAGON_USER_WALLETS_URL).arg("signin-dummy") },
+    };
+    return templates;
+}
+
+QString resolveForChain(const QString &url, int chain)
+{
+    if ((int)AppSetting::Chain::TESTNET != chain) {
+        return url;
+    }
+    QString resolved = url;
+    if (resolved.startsWith(DRAGON_USER_WALLETS_URL)) {
+        resolved.replace(0, int(sizeof(DRAGON_USER_WALLETS_URL)) - 1, DRAGON_USER_WALLETS_TESTNET_URL);
+    }
+    else if (resolved.startsWith(DRAGON_GROUP_WALLETS_URL)) {
+        resolved.replace(0, int(sizeof(DRAGON_GROUP_WALLETS_URL)) - 1, DRAGON_GROUP_WALLETS_TESTNET_URL);
+    }
+    return resolved;
+}
+
+struct ResolvedEndpoints {
+    QReadWriteLock   lock;
+    int              chain {-1};
+    QVector<QString> urls;
+};
+
+ResolvedEndpoints &resolvedEndpoints()
+{
+    static ResolvedEndpoints mInstance;
+    return mInstance;
+}
+
+// Callers hold the write lock
+void resolveEndpoints(ResolvedEndpoints &endpoints, int chain)
+{
+    const QMap<int, QString> &templates = endpointTemplates();
+    endpoints.urls = QVector<QString>(Group::CMD_IDX::CMD_MAX + 1);
+    for (auto it = templates.constBegin(); it != templates.constEnd(); ++it) {
+        if (it.key() >= 0 && it.key() < endpoints.urls.size()) {
+            endpoints.urls[it.key()] = resolveForChain(it.value(), chain);
+        }
+    }
+    endpoints.chain = chain;
+}
+}
+
+QString EndpointTable::operator[](int cmd) const
+{
+    ResolvedEndpoints &endpoints = resolvedEndpoints();
+    // Reading the chain goes through QSettings, so it is read on first use and
+    // then only again when AppSetting reports a network change
+    static const bool watching = []() {
+        QObject::connect(AppSetting::instance(), &AppSetting::primaryServerChanged, AppSetting::instance(), []() {
+            ResolvedEndpoints &endpoints = resolvedEndpoints();
+            QWriteLocker locker(&endpoints.lock);
+            resolveEndpoints(endpoints, AppSetting::instance()->primaryServer());
+        });
+        return true;
+    }();
+    Q_UNUSED(watching);
+    {
+        QReadLocker locker(&endpoints.lock);
+        if (endpoints.chain >= 0) {
+            return endpoints.urls.value(cmd);
+        }
+    }
+    QWriteLocker locker(&endpoints.lock);
+    if (endpoints.chain < 0) {
+        resolveEndpoints(endpoints, AppSetting::instance()->primaryServer());
+    }
+    return endpoints.urls.value(cmd);
+}
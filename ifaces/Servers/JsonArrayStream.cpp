@@ -0,0 +1,209 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+
+#include "JsonArrayStream.h"
+#include "QOutlog.h"
+#include <QJsonDocument>
+
+JsonArrayStream::JsonArrayStream(const QString &arrayPath, Element onElement)
+    : m_path(arrayPath.split('/', QString::SkipEmptyParts))
+    , m_onElement(onElement)
+{
+
+}
+
+void JsonArrayStream::feed(const QByteArray &chunk)
+{
+    const char *data = chunk.constData();
+    const int size = chunk.size();
+    // Start of the bytes not yet copied into the envelope or the current element
+    int mark = 0;
+    for (int i = 0; i < size; i++) {
+        const char c = data[i];
+        if (m_inString) {
+            if (m_escape) {
+                m_escape = false;
+            }
+            else if (c == '\\') {
+                m_escape = true;
+            }
+            else if (c == '"') {
+                m_inString = false;
+                if (m_captureKey) {
+                    m_captureKey = false;
+                    m_keys.last() = QString::fromUtf8(m_keyBuffer);
+                }
+                continue;
+            }
+            if (m_captureKey) {
+                m_keyBuffer.append(c);
+            }
+            continue;
+        }
+        switch (m_mode) {
+        case Mode::ENVELOPE:
+            switch (c) {
+            case '"':
+                m_inString = true;
+                if (!m_stack.isEmpty() && m_stack.last() == '{' && m_expectKey) {
+                    m_captureKey = true;
+                    m_keyBuffer.clear();
+                }
+                break;
+            case '{':
+            case '[':
+                if (c == '[' && !m_found && atArrayPath()) {
+                    m_envelope.append(data + mark, i + 1 - mark);
+                    mark = i + 1;
+                    m_mode = Mode::ARRAY;
+                }
+                m_stack.append(c);
+                m_keys.append(QString());
+                m_expectKey = (c == '{');
+                break;
+            case '}':
+            case ']':
+                if (!m_stack.isEmpty()) {
+                    m_stack.removeLast();
+                    m_keys.removeLast();
+                }
+                m_expectKey = false;
+                break;
+            case ':':
+                m_expectKey = false;
+                break;
+            case ',':
+                m_expectKey = !m_stack.isEmpty() && m_stack.last() == '{';
+                break;
+            default:
+                break;
+            }
+            break;
+        case Mode::ARRAY:
+            if (c == ']') {
+                m_stack.removeLast();
+                m_keys.removeLast();
+                m_found = true;
+                m_expectKey = false;
+                m_mode = Mode::ENVELOPE;
+                mark = i;
+            }
+            else if (c != ',' && c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                m_mode = Mode::ELEMENT;
+                m_elementDepth = 0;
+                mark = i;
+                // Re-read the first byte as part of the element
+                i--;
+            }
+            break;
+        case Mode::ELEMENT:
+            switch (c) {
+            case '"':
+                m_inString = true;
+                break;
+            case '{':
+            case '[':
+                m_elementDepth++;
+                break;
+            case '}':
+            case ']':
+                if (m_elementDepth > 0) {
+                    m_elementDepth--;
+                    if (m_elementDepth == 0) {
+                        m_element.append(data + mark, i + 1 - mark);
+                        mark = i + 1;
+                        emitElement();
+                        m_mode = Mode::ARRAY;
+                    }
+                    break;
+                }
+                // A scalar element closed by the end of the array
+                m_element.truncate(0);
+                m_mode = Mode::ARRAY;
+                i--;
+                break;
+            case ',':
+                if (m_elementDepth == 0) {
+                    m_element.truncate(0);
+                    m_mode = Mode::ARRAY;
+                }
+                break;
+            default:
+                break;
+            }
+            break;
+        }
+    }
+    if (m_mode == Mode::ENVELOPE) {
+        m_envelope.append(data + mark, size - mark);
+    }
+    else if (m_mode == Mode::ELEMENT) {
+        m_element.append(data + mark, size - mark);
+    }
+}
+
+QJsonObject JsonArrayStream::envelope() const
+{
+    return QJsonDocument::fromJson(m_envelope).object();
+}
+
+int JsonArrayStream::count() const
+{
+    return m_count;
+}
+
+bool JsonArrayStream::found() const
+{
+    return m_found;
+}
+
+bool JsonArrayStream::hasError() const
+{
+    return m_error || m_mode != Mode::ENVELOPE;
+}
+
+bool JsonArrayStream::atArrayPath() const
+{
+    if (m_stack.size() != m_path.size()) {
+        return false;
+    }
+    for (int i = 0; i < m_path.size(); i++) {
+        if (m_stack.at(i) != '{' || m_keys.at(i) != m_path.at(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void JsonArrayStream::emitElement()
+{
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(m_element, &error);
+    m_element.truncate(0);
+    if (error.error != QJsonParseError::NoError) {
+        DBG_INFO << "Skipping unreadable element" << m_count << error.errorString();
+        m_error = true;
+        return;
+    }
+    m_count++;
+    if (doc.isObject() && m_onElement) {
+        m_onElement(doc.object());
+    }
+}
@@ -0,0 +1,75 @@
+/**************************************************************************
+ * This file is part of the Nunchuk software (https://nunchuk.io/)        *
+ * Copyright (C) 2020-2022 Enigmo								          *
+ * Copyright (C) 2022 Nunchuk								              *
+ *                                                                        *
+ * This program is free software; you can redistribute it and/or          *
+ * modify it under the terms of the GNU General Public License            *
+ * as published by the Free Software Foundation; either version 3         *
+ * of the License, or (at your option) any later version.                 *
+ *                                                                        *
+ * This program is distributed in the hope that it will be useful,        *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ * GNU General Public License for more details.                           *
+ *                                                                        *
+ * You should have received a copy of the GNU General Public License      *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                        *
+ **************************************************************************/
+
+#ifndef JSONARRAYSTREAM_H
+#define JSONARRAYSTREAM_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QStringList>
+#include <QVector>
+#include <functional>
+
+// Incremental reader for REST responses that carry one large array, e.g.
+// {"error":{...},"data":{"transactions":[...]}}. Bytes are fed as they arrive;
+// each element of the array at arrayPath is parsed on its own and handed to the
+// callback, so only one element and the (array-less) envelope are ever buffered.
+class JsonArrayStream
+{
+public:
+    typedef std::function<void(const QJsonObject &element)> Element;
+
+    JsonArrayStream(const QString &arrayPath, Element onElement);
+
+    void feed(const QByteArray &chunk);
+    // Everything outside the streamed array, with the array itself left empty
+    QJsonObject envelope() const;
+    int  count() const;
+    bool found() const;
+    bool hasError() const;
+
+private:
+    enum class Mode {
+        ENVELOPE,
+        ARRAY,
+        ELEMENT,
+    };
+    bool atArrayPath() const;
+    void emitElement();
+
+    QStringList     m_path;
+    Element         m_onElement;
+    Mode            m_mode {Mode::ENVELOPE};
+    QVector<char>   m_stack;
+    QStringList     m_keys;
+    QByteArray      m_keyBuffer;
+    QByteArray      m_envelope;
+    QByteArray      m_element;
+    int             m_elementDepth {0};
+    int             m_count {0};
+    bool            m_inString {false};
+    bool            m_escape {false};
+    bool            m_captureKey {false};
+    bool            m_expectKey {false};
+    bool            m_found {false};
+    bool            m_error {false};
+};
+
+#endif // JSONARRAYSTREAM_H
@@ -21,13 +21,62 @@
 #include "QRest.h"
 #include "AppModel.h"
 #include "QOutlog.h"
+#include <QThread>
+#include <QThreadStorage>
+#include <QMutex>
+
+namespace {
+// One cookie store for every manager, whichever thread it lives on; QNetworkAccessManager
+// only goes through these virtuals, so locking them makes the jar safe to share
+class SharedCookieJar : public QNetworkCookieJar
+{
+public:
+    QList<QNetworkCookie> cookiesForUrl(const QUrl &url) const override
+    {
+        QMutexLocker locker(&m_mutex);
+        return QNetworkCookieJar::cookiesForUrl(url);
+    }
+    bool setCookiesFromUrl(const QList<QNetworkCookie> &cookieList, const QUrl &url) override
+    {
+        QMutexLocker locker(&m_mutex);
+        return QNetworkCookieJar::setCookiesFromUrl(cookieList, url);
+    }
+    bool insertCookie(const QNetworkCookie &cookie) override
+    {
+        QMutexLocker locker(&m_mutex);
+        return QNetworkCookieJar::insertCookie(cookie);
+    }
+    bool updateCookie(const QNetworkCookie &cookie) override
+    {
+        QMutexLocker locker(&m_mutex);
+        return QNetworkCookieJar::updateCookie(cookie);
+    }
+    bool deleteCookie(const QNetworkCookie &cookie) override
+    {
+        QMutexLocker locker(&m_mutex);
+        return QNetworkCookieJar::deleteCookie(cookie);
+    }
+private:
+    mutable QMutex m_mutex {QMutex::Recursive};
+};
+
+void useSharedCookieJar(QNetworkAccessManager *manager)
+{
+    static SharedCookieJar *jar = new SharedCookieJar();
+    manager->setCookieJar(jar);
+    // A manager on the jar's thread adopts it as a child; keep it alive for the others
+    if (jar->parent()) {
+        jar->setParent(nullptr);
+    }
+}
+}
 
 QString    QRest::m_dracoToken      = "";
 QByteArray QRest::m_machineUniqueId = QSysInfo::machineUniqueId();
 
 QRest::QRest() : m_networkManager(new QNetworkAccessManager())
 {
-    m_networkManager->setCookieJar(new QNetworkCookieJar(m_networkManager));
+    useSharedCookieJar(m_networkManager);
 }
 
 QRest::~QRest()
@@ -50,12 +99,29 @@ QByteArray QRest::machineUniqueId()
     return m_machineUniqueId;
 }
 
+QNetworkAccessManager *QRest::networkManager()
+{
+    if (QThread::currentThread() == m_networkManager->thread()) {
+        return m_networkManager;
+    }
+    // QNetworkAccessManager is not thread-safe; requests issued concurrently from
+    // worker threads each go through a manager owned by their own thread. Those threads
+    // come from long-lived pools, so the managers keep their connections between calls,
+    // and all managers share one cookie jar with m_networkManager.
+    static QThreadStorage<QNetworkAccessManager*> managers;
+    if (!managers.hasLocalData()) {
+        QNetworkAccessManager *manager = new QNetworkAccessManager();
+        useSharedCookieJar(manager);
+        managers.setLocalData(manager);
+    }
+    return managers.localData();
+}
+
 QJsonObject QRest::postSync(const QString &cmd, QJsonObject data, int& reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
-    QFunctionTime f(QString("POST %1").arg(command));
+    QFunctionTime f(QString("POST %1").arg(cmd));
     QJsonObject ret;
-    QNetworkRequest requester_(QUrl::fromUserInput(command));
+    QNetworkRequest requester_(QUrl::fromUserInput(cmd));
     QString headerData = QString("Bearer %1").arg(dracoToken());
     requester_.setRawHeader("Authorization", headerData.toLocal8Bit());
     requester_.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
@@ -66,7 +132,7 @@ QJsonObject QRest::postSync(const QString &cmd, QJsonObject data, int& reply_cod
     requester_.setRawHeader("x-nc-os-name", QSysInfo::productType().toUtf8());
     qint64 maximumBufferSize = 1024 * 1024;
     requester_.setAttribute(QNetworkRequest::MaximumDownloadBufferSizeAttribute, maximumBufferSize);
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->post(requester_, QJsonDocument(data).toJson()));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->post(requester_, QJsonDocument(data).toJson()));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
@@ -91,10 +157,9 @@ QJsonObject QRest::postSync(const QString &cmd, QJsonObject data, int& reply_cod
 
 QJsonObject QRest::postSync(const QString &cmd, QMap<QString, QString> paramsQuery, QMap<QString, QString> paramsHeader, QJsonObject data, int &reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
-    QFunctionTime f(QString("POST %1").arg(command));
+    QFunctionTime f(QString("POST %1").arg(cmd));
     QJsonObject ret;
-    QUrl url = QUrl::fromUserInput(command);
+    QUrl url = QUrl::fromUserInput(cmd);
     if(!paramsQuery.isEmpty()){
         QUrlQuery params;
         foreach(const QString& key, paramsQuery.keys()) {
@@ -119,7 +184,7 @@ QJsonObject QRest::postSync(const QString &cmd, QMap<QString, QString> paramsQue
     for(QString param : paramsHeader.keys()) {
         requester_.setRawHeader(QByteArray::fromStdString(param.toStdString()), QByteArray::fromStdString(paramsHeader.value(param).toStdString()));
     }
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->post(requester_, QJsonDocument(data).toJson()));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->post(requester_, QJsonDocument(data).toJson()));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
@@ -146,10 +211,9 @@ QJsonObject QRest::postSync(const QString &cmd, QMap<QString, QString> paramsQue
 
 QJsonObject QRest::getSync(const QString &cmd, QJsonObject data, int &reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
-    QFunctionTime f(QString("GET %1").arg(command));
+    QFunctionTime f(QString("GET %1").arg(cmd));
     QJsonObject ret;
-    QUrl url = QUrl::fromUserInput(command);
+    QUrl url = QUrl::fromUserInput(cmd);
     if(!data.isEmpty()){
         QUrlQuery params;
         foreach(const QString& key, data.keys()) {
@@ -171,7 +235,7 @@ QJsonObject QRest::getSync(const QString &cmd, QJsonObject data, int &reply_code
     qint64 maximumBufferSize = 1024 * 1024;
     requester_.setAttribute(QNetworkRequest::MaximumDownloadBufferSizeAttribute, maximumBufferSize);
     // Add addional params
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->get(requester_));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->get(requester_));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
@@ -197,10 +261,9 @@ QJsonObject QRest::getSync(const QString &cmd, QJsonObject data, int &reply_code
 
 QJsonObject QRest::getSync(const QString &cmd, QMap<QString, QString> paramsHeader, QJsonObject data, int &reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
-    QFunctionTime f(QString("GET %1").arg(command));
+    QFunctionTime f(QString("GET %1").arg(cmd));
     QJsonObject ret;
-    QUrl url = QUrl::fromUserInput(command);
+    QUrl url = QUrl::fromUserInput(cmd);
     if(!data.isEmpty()){
         QUrlQuery params;
         foreach(const QString& key, data.keys()) {
@@ -225,7 +288,7 @@ QJsonObject QRest::getSync(const QString &cmd, QMap<QString, QString> paramsHead
     for(QString param : paramsHeader.keys()) {
         requester_.setRawHeader(QByteArray::fromStdString(param.toStdString()), QByteArray::fromStdString(paramsHeader.value(param).toStdString()));
     }
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->get(requester_));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->get(requester_));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
@@ -249,12 +312,72 @@ QJsonObject QRest::getSync(const QString &cmd, QMap<QString, QString> paramsHead
     return ret;
 }
 
+QJsonObject QRest::getStream(const QString &cmd, QJsonObject data, const QString &arrayPath, JsonArrayStream::Element onElement, int &reply_code, QString &reply_msg)
+{
+    QFunctionTime f(QString("GET %1").arg(cmd));
+    QUrl url = QUrl::fromUserInput(cmd);
+    if(!data.isEmpty()){
+        QUrlQuery params;
+        foreach(const QString& key, data.keys()) {
+            QJsonValue value        = data.value(key);
+            QString encodedValue    = QUrl::toPercentEncoding(value.toString());
+            params.addQueryItem(key, encodedValue);
+        }
+        url.setQuery(params);
+    }
+    QNetworkRequest requester_(url);
+    QString headerData = QString("Bearer %1").arg(dracoToken());
+    requester_.setRawHeader("Authorization", headerData.toLocal8Bit());
+    requester_.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+    requester_.setRawHeader("Connection", "keep-alive");
+    requester_.setRawHeader("x-nc-device-id", machineUniqueId());
+    requester_.setRawHeader("x-nc-app-version", qApp->applicationVersion().toUtf8());
+    requester_.setRawHeader("x-nc-device-class", "Desktop");
+    requester_.setRawHeader("x-nc-os-name", QSysInfo::productType().toUtf8());
+    // The buffer is drained on every readyRead, so it only has to hold one network chunk
+    qint64 maximumBufferSize = 64 * 1024;
+    requester_.setAttribute(QNetworkRequest::MaximumDownloadBufferSizeAttribute, maximumBufferSize);
+    JsonArrayStream stream(arrayPath, onElement);
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->get(requester_));
+    QEventLoop eventLoop;
+    QNetworkReply *raw = reply.get();
+    QObject::connect(raw,   &QNetworkReply::readyRead,  &eventLoop, [raw, &stream]() { stream.feed(raw->readAll()); });
+    QObject::connect(raw,   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
+    eventLoop.exec();
+    DBG_INFO << requester_.url().toString();
+    if (reply->error() == QNetworkReply::NoError) {
+        reply_code = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        reply_msg  = reply->errorString();
+    }
+    else{
+        reply_code = reply->error();
+        reply_msg  = reply->errorString();
+        if(reply_code >= QNetworkReply::ConnectionRefusedError && reply_code <= QNetworkReply::UnknownNetworkError){
+            reply_msg = STR_CPP_111;
+        }
+        AppModel::instance()->showToast(reply_code, reply_msg, EWARNING::WarningType::EXCEPTION_MSG);
+    }
+    stream.feed(reply->readAll());
+    QJsonObject envelope = stream.envelope();
+    // A successful envelope must have carried the array; without it (or with a truncated or
+    // garbled body) the elements handed out so far are only part of the list
+    bool missing = !stream.found() && envelope["error"].toObject()["code"].toInt() == DRACO_CODE::RESPONSE_OK;
+    if (stream.hasError() || missing) {
+        DBG_INFO << "Incomplete stream" << arrayPath << "elements:" << stream.count();
+        if (reply_code == DRACO_CODE::SUCCESSFULL) {
+            reply_code = QNetworkReply::ProtocolFailure;
+            reply_msg  = QString("Incomplete response for %1").arg(arrayPath);
+        }
+    }
+    reply.release()->deleteLater();
+    return envelope;
+}
+
 QJsonObject QRest::putSync(const QString &cmd, QJsonObject data, int &reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
-    QFunctionTime f(QString("PUT %1").arg(command));
+    QFunctionTime f(QString("PUT %1").arg(cmd));
     QJsonObject ret;
-    QNetworkRequest requester_(QUrl::fromUserInput(command));
+    QNetworkRequest requester_(QUrl::fromUserInput(cmd));
     QString headerData = QString("Bearer %1").arg(dracoToken());
     requester_.setRawHeader("Authorization", headerData.toLocal8Bit());
     requester_.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
@@ -265,7 +388,7 @@ QJsonObject QRest::putSync(const QString &cmd, QJsonObject data, int &reply_code
     requester_.setRawHeader("x-nc-os-name", QSysInfo::productType().toUtf8());
     qint64 maximumBufferSize = 1024 * 1024;
     requester_.setAttribute(QNetworkRequest::MaximumDownloadBufferSizeAttribute, maximumBufferSize);
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->put(requester_, QJsonDocument(data).toJson()));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->put(requester_, QJsonDocument(data).toJson()));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
@@ -291,9 +414,8 @@ QJsonObject QRest::putSync(const QString &cmd, QJsonObject data, int &reply_code
 
 QJsonObject QRest::putSync(const QString &cmd, QMap<QString, QString> paramsQuery, QMap<QString, QString> paramsHeader, QJsonObject data, int &reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
     QJsonObject ret;
-    QUrl url = QUrl::fromUserInput(command);
+    QUrl url = QUrl::fromUserInput(cmd);
     if(!paramsQuery.isEmpty()){
         QUrlQuery params;
         foreach(const QString& key, paramsQuery.keys()) {
@@ -319,7 +441,7 @@ QJsonObject QRest::putSync(const QString &cmd, QMap<QString, QString> paramsQuer
     for(QString param : paramsHeader.keys()) {
         requester_.setRawHeader(QByteArray::fromStdString(param.toStdString()), QByteArray::fromStdString(paramsHeader.value(param).toStdString()));
     }
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->put(requester_, QJsonDocument(data).toJson()));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->put(requester_, QJsonDocument(data).toJson()));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
@@ -345,10 +467,9 @@ QJsonObject QRest::putSync(const QString &cmd, QMap<QString, QString> paramsQuer
 
 QJsonObject QRest::deleteSync(const QString &cmd, QJsonObject data, int &reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
-    QFunctionTime f(QString("DELETE %1").arg(command));
+    QFunctionTime f(QString("DELETE %1").arg(cmd));
     QJsonObject ret;
-    QNetworkRequest requester_(QUrl::fromUserInput(command));
+    QNetworkRequest requester_(QUrl::fromUserInput(cmd));
     QString headerData = QString("Bearer %1").arg(dracoToken());
     requester_.setRawHeader("Authorization", headerData.toLocal8Bit());
     requester_.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
@@ -359,7 +480,7 @@ QJsonObject QRest::deleteSync(const QString &cmd, QJsonObject data, int &reply_c
     requester_.setRawHeader("x-nc-os-name", QSysInfo::productType().toUtf8());
     qint64 maximumBufferSize = 1024 * 1024;
     requester_.setAttribute(QNetworkRequest::MaximumDownloadBufferSizeAttribute, maximumBufferSize);
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->sendCustomRequest(requester_, "DELETE", QJsonDocument(data).toJson()));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->sendCustomRequest(requester_, "DELETE", QJsonDocument(data).toJson()));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
@@ -385,8 +506,7 @@ QJsonObject QRest::deleteSync(const QString &cmd, QJsonObject data, int &reply_c
 
 QJsonObject QRest::deleteSync(const QString &cmd, QMap<QString, QString> paramsQuery, QMap<QString, QString> paramsHeader, QJsonObject data, int &reply_code, QString &reply_msg)
 {
-    QString command = commandByNetwork(cmd);
-    QUrl url = QUrl::fromUserInput(command);
+    QUrl url = QUrl::fromUserInput(cmd);
     if(!paramsQuery.isEmpty()){
         QUrlQuery params;
         foreach(const QString& key, paramsQuery.keys()) {
@@ -413,7 +533,7 @@ QJsonObject QRest::deleteSync(const QString &cmd, QMap<QString, QString> paramsQ
     for(QString param : paramsHeader.keys()) {
         requester_.setRawHeader(QByteArray::fromStdString(param.toStdString()), QByteArray::fromStdString(paramsHeader.value(param).toStdString()));
     }
-    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(m_networkManager->sendCustomRequest(requester_, "DELETE", QJsonDocument(data).toJson()));
+    std::unique_ptr<QNetworkReply, std::default_delete<QNetworkReply>> reply(networkManager()->sendCustomRequest(requester_, "DELETE", QJsonDocument(data).toJson()));
     QEventLoop eventLoop;
     QObject::connect(reply.get(),   &QNetworkReply::finished,   &eventLoop, &QEventLoop::quit);
     eventLoop.exec();
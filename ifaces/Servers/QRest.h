@@ -38,6 +38,7 @@
 #include <QJsonObject>
 #include <QNetworkReply>
 #include "DracoDefines.h"
+#include "JsonArrayStream.h"
 
 class QRest : public QObject
 {
@@ -52,10 +53,13 @@ public:
 
 protected:
     QNetworkAccessManager *m_networkManager;
+    QNetworkAccessManager *networkManager();
     QJsonObject postSync(const QString &cmd, QJsonObject data, int &reply_code, QString &reply_msg);
     QJsonObject postSync(const QString &cmd, QMap<QString, QString> paramsQuery, QMap<QString, QString> paramsHeader, QJsonObject data, int &reply_code, QString &reply_msg);
     QJsonObject getSync(const QString &cmd, QJsonObject data, int &reply_code, QString &reply_msg);
     QJsonObject getSync(const QString &cmd, QMap<QString, QString> paramsHeader, QJsonObject data, int &reply_code, QString &reply_msg);
+    // Same as getSync, but the array at arrayPath is delivered element by element while the body downloads
+    QJsonObject getStream(const QString &cmd, QJsonObject data, const QString &arrayPath, JsonArrayStream::Element onElement, int &reply_code, QString &reply_msg);
     QJsonObject putSync(const QString &cmd, QJsonObject data, int &reply_code, QString &reply_msg);
     QJsonObject putSync(const QString &cmd, QMap<QString, QString> paramsQuery, QMap<QString, QString> paramsHeader, QJsonObject data, int &reply_code, QString &reply_msg);
     QJsonObject deleteSync(const QString &cmd, QJsonObject data, int &reply_code, QString &reply_msg);
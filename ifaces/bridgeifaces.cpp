@@ -26,6 +26,8 @@
 #include "utils/enumconverter.hpp"
 #include "Servers/Draco.h"
 #include "ProfileSetting.h"
+#include "Commons/PsbtImportCache.h"
+#include "Commons/TapsignerStatusCache.h"
 
 void bridge::nunchukMakeInstance(const QString& passphrase,
                                  QWarningMessage& msg)
@@ -198,11 +200,7 @@ QWalletListModelPtr bridge::nunchukGetWallets() {
     QWarningMessage msg;
     std::vector<nunchuk::Wallet> resultWallets = nunchukiface::instance()->GetWallets(msg);
     if((int)EWARNING::WarningType::NONE_MSG == msg.type()){
-        QWalletListModelPtr walletList(new WalletListModel());
-        for (nunchuk::Wallet it : resultWallets) {
-            walletList.data()->addWallet(bridge::convertWallet(it));
-        }
-        return walletList;
+        return nunchukConvertWallets(std::move(resultWallets));
     }
     else{
         return NULL;
@@ -217,9 +215,7 @@ std::vector<nunchuk::Wallet> bridge::nunchukGetOriginWallets(QWarningMessage& ms
 QWalletListModelPtr bridge::nunchukConvertWallets(std::vector<nunchuk::Wallet> list)
 {
     QWalletListModelPtr walletList(new WalletListModel());
-    for (nunchuk::Wallet it : list) {
-        walletList.data()->addWallet(bridge::convertWallet(it));
-    }
+    walletList.data()->addWallets(std::move(list));
     return walletList;
 }
 
@@ -271,7 +267,7 @@ nunchuk::MasterSigner bridge::nunchukGetOriginMasterSigner(const QString &id, QW
 QMasterSignerListModelPtr bridge::nunchukConvertMasterSigners(std::vector<nunchuk::MasterSigner> list)
 {
     QMasterSignerListModelPtr masterSignerlist(new MasterSignerListModel());
-    for (nunchuk::MasterSigner it : list) {
+    for (const nunchuk::MasterSigner &it : list) {
         QMasterSignerPtr signer = QMasterSignerPtr(new QMasterSigner(it));
         int signer_type = (int)it.get_type();
         if(signer_type == (int)ENUNCHUCK::SignerType::SERVER){
@@ -281,10 +277,10 @@ QMasterSignerListModelPtr bridge::nunchukConvertMasterSigners(std::vector<nunchu
             AppModel::instance()->softwareSignerDeviceList()->addDevice(QDevicePtr(new QDevice(it.get_device())));
         }
         if(signer_type == (int)ENUNCHUCK::SignerType::NFC){
-            QWarningMessage msgGetTap;
-            nunchuk::TapsignerStatus tapsigner = nunchukiface::instance()->GetTapsignerStatusFromMasterSigner(it.get_device().get_master_fingerprint(), msgGetTap);
-            if((int)EWARNING::WarningType::NONE_MSG == msgGetTap.type()){
-                signer.data()->device()->setCardId(QString::fromStdString(tapsigner.get_card_ident()));
+            // Served from the cache; a missing card id is filled in once the background lookup lands
+            TapsignerStatusCache::Status tapsigner;
+            if(TapsignerStatusCache::instance()->status(QString::fromStdString(it.get_device().get_master_fingerprint()), tapsigner)){
+                signer.data()->device()->setCardId(tapsigner.cardIdent);
             }
         }
         masterSignerlist.data()->addMasterSigner(signer);
@@ -944,7 +940,11 @@ bool bridge::nunchukDeleteTransaction(const QString &wallet_id, const QString &t
 bool bridge::nunchukDeleteMasterSigner(const QString &mastersigner_id)
 {
     QWarningMessage msg;
-    return nunchukiface::instance()->DeleteMasterSigner(mastersigner_id.toStdString(), msg);
+    bool ret = nunchukiface::instance()->DeleteMasterSigner(mastersigner_id.toStdString(), msg);
+    if(ret){
+        TapsignerStatusCache::instance()->remove(mastersigner_id);
+    }
+    return ret;
 }
 
 bool bridge::nunchukDeletePrimaryKey()
@@ -976,6 +976,8 @@ bool bridge::nunchukDeleteWallet(const QString &wallet_id, QWarningMessage& msg)
     bool ret = nunchukiface::instance()->DeleteWallet(wallet_id.toStdString(), msg);
     if(ret){
         AppSetting::instance()->deleteWalletCached(wallet_id);
+        TransactionSnapshot::remove(wallet_id);
+        PsbtImportCache::remove(wallet_id);
     }
     return ret;
 }
@@ -988,6 +990,8 @@ void bridge::nunchukDeleteAllWallet()
         bool ret = nunchukiface::instance()->DeleteWallet(it.get_id(), msg);
         if(ret){
             AppSetting::instance()->deleteWalletCached(QString::fromStdString(it.get_id()));
+            TransactionSnapshot::remove(QString::fromStdString(it.get_id()));
+            PsbtImportCache::remove(QString::fromStdString(it.get_id()));
         }
     }
 }
@@ -1046,10 +1050,7 @@ QTransactionListModelPtr bridge::nunchukGetTransactionHistory(const QString &wal
                                                                                                      msg);
     if((int)EWARNING::WarningType::NONE_MSG == msg.type()){
         QTransactionListModelPtr trans_ret = QTransactionListModelPtr(new TransactionListModel);
-        for (nunchuk::Transaction it : trans_result) {
-            QTransactionPtr tx = convertTransaction(it, wallet_id);
-            trans_ret.data()->addTransaction(tx);
-        }
+        trans_ret.data()->updateTransaction(wallet_id, trans_result);
         return trans_ret;
     }
     return QTransactionListModelPtr(new TransactionListModel);
@@ -2028,6 +2029,7 @@ QMasterSignerPtr bridge::ImportTapsignerMasterSigner( const std::vector<unsigned
         nunchuk::TapsignerStatus tapsigner = nunchukiface::instance()->GetTapsignerStatusFromMasterSigner(it.get_device().get_master_fingerprint(), msgGetTap);
         if((int)EWARNING::WarningType::NONE_MSG == msgGetTap.type()){
             signer.data()->device()->setCardId(QString::fromStdString(tapsigner.get_card_ident()));
+            TapsignerStatusCache::instance()->update(QString::fromStdString(it.get_device().get_master_fingerprint()), tapsigner);
         }
         return signer;
     }
@@ -2182,6 +2184,7 @@ QMasterSignerPtr bridge::ImportBackupKey(const std::vector<unsigned char> &data,
         nunchuk::TapsignerStatus tapsigner = nunchukiface::instance()->GetTapsignerStatusFromMasterSigner(it.get_device().get_master_fingerprint(), msgGetTap);
         if((int)EWARNING::WarningType::NONE_MSG == msgGetTap.type()){
             signer.data()->device()->setCardId(QString::fromStdString(tapsigner.get_card_ident()));
+            TapsignerStatusCache::instance()->update(QString::fromStdString(it.get_device().get_master_fingerprint()), tapsigner);
         }
         return signer;
     }
@@ -21,6 +21,7 @@
 #include "nunchucklistener.h"
 #include "QOutlog.h"
 #include "utils/enumconverter.hpp"
+#include "Commons/SignerRegistry.h"
 
 nunchukiface::nunchukiface(): nunchukMode_(LOCAL_MODE){}
 
@@ -135,6 +136,7 @@ nunchuk::Wallet nunchukiface::CreateWallet(const std::string &name,
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->CreateWallet(name, m, n, signers, address_type, is_escrow, desc);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -153,6 +155,7 @@ nunchuk::Wallet nunchukiface::CreateWallet(const nunchuk::Wallet &wallet, bool a
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->CreateWallet(wallet,allow_used_signer);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -307,6 +310,7 @@ nunchuk::Wallet nunchukiface::ImportWalletDb(const std::string &file_path, QWarn
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->ImportWalletDb(file_path);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -328,6 +332,7 @@ nunchuk::Wallet nunchukiface::ImportWalletDescriptor(const std::string& file_pat
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->ImportWalletDescriptor(file_path, name, description);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -362,6 +367,7 @@ nunchuk::MasterSigner nunchukiface::CreateMasterSigner(const std::string &name,
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->CreateMasterSigner(name, device, create_master_signer_listener);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -437,6 +443,7 @@ nunchuk::SingleSigner nunchukiface::CreateSigner(const std::string &name,
                                                                  type,
                                                                  tags,
                                                                  replace);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -643,6 +650,7 @@ bool nunchukiface::DeleteMasterSigner(const std::string &mastersigner_id, QWarni
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->DeleteMasterSigner(mastersigner_id);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -663,6 +671,7 @@ bool nunchukiface::DeleteRemoteSigner(const std::string &master_fingerprint, con
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->DeleteRemoteSigner(master_fingerprint, derivation_path);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -1553,6 +1562,7 @@ nunchuk::SingleSigner nunchukiface::CreateCoboSigner(const std::string &name, co
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->CreateCoboSigner(name, json_info);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -1643,6 +1653,7 @@ nunchuk::Wallet nunchukiface::ImportWalletConfigFile(const std::string &file_pat
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->ImportWalletConfigFile(file_path, description);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -1666,6 +1677,7 @@ nunchuk::MasterSigner nunchukiface::CreateSoftwareSigner(const std::string &name
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->CreateSoftwareSigner(name, mnemonic, passphrase, create_software_signer_listener,isPrimaryKey, replace);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -1688,6 +1700,7 @@ nunchuk::MasterSigner nunchukiface::CreateSoftwareSignerFromMasterXprv(const std
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->CreateSoftwareSignerFromMasterXprv(name, master_xprv, create_software_signer_listener, is_primary, replace);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -2149,6 +2162,7 @@ nunchuk::MasterSigner nunchukiface::ImportTapsignerMasterSigner(const std::vecto
                                                                           name,
                                                                           ImportTapsignerMasterSignerProgress,
                                                                           is_primary);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -2480,6 +2494,7 @@ nunchuk::Wallet nunchukiface::CreateHotWallet(const std::string& mnemonic, const
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->CreateHotWallet(mnemonic, passphraser, need_backup, replace);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -2514,6 +2529,7 @@ nunchuk::MasterSigner nunchukiface::ImportColdcardBackup(const std::vector<unsig
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->ImportColdcardBackup(data, backup_key, name, progress, is_primary);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
@@ -2532,6 +2548,7 @@ nunchuk::MasterSigner nunchukiface::ImportBackupKey(const std::vector<unsigned c
     try {
         if(nunchuk_instance_[nunchukMode()]){
             ret = nunchuk_instance_[nunchukMode()]->ImportBackupKey(data, backup_key, name, ImportTapsignerMasterSignerProgress, is_primary);
+            SignerRegistry::instance()->invalidate();
         }
     }
     catch (const nunchuk::BaseException &ex) {
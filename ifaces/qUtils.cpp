@@ -58,13 +58,40 @@ qint64 qUtils::QAmountFromValue(const QString &btcValue, const bool allow_negati
 }
 
 QString qUtils::QValueFromAmount(const qint64 &amount) {
-    QString ret = "";
-    ret = QString::fromStdString(nunchuk::Utils::ValueFromAmount(amount));
+    // Same output as nunchuk::Utils::ValueFromAmount ("%s%d.%08d"), built with integer arithmetic
+    constexpr qint64 COIN = 100000000;
+    const bool sign = amount < 0;
+    const quint64 n_abs = sign ? (0 - static_cast<quint64>(amount)) : static_cast<quint64>(amount);
+    const quint64 quotient = n_abs / COIN;
+    quint64 remainder = n_abs % COIN;
+
+    char buf[32];
+    char *end = buf + sizeof(buf);
+    char *p = end;
+    for (int i = 0; i < 8; i++) {
+        *--p = static_cast<char>('0' + remainder % 10);
+        remainder /= 10;
+    }
+    char *fraction = p;
+    *--p = '.';
+    quint64 q = quotient;
+    do {
+        *--p = static_cast<char>('0' + q % 10);
+        q /= 10;
+    } while (q > 0);
+    if (sign) {
+        *--p = '-';
+    }
     if((int)AppSetting::Unit::BTC == AppSetting::instance()->unit() && false == AppSetting::instance()->enableFixedPrecision()){
-        ret.remove( QRegExp("0+$") ); // Remove any number of trailing 0's
-        ret.remove( QRegExp("\\.$") ); // If the last character is just a '.' then remove it
+        // Remove any number of trailing 0's, then the '.' if nothing is left after it
+        while (end > fraction && *(end - 1) == '0') {
+            --end;
+        }
+        if (end == fraction) {
+            --end;
+        }
     }
-    return ret;
+    return QString::fromLatin1(p, static_cast<int>(end - p));
 }
 
 QString qUtils::QGenerateRandomMessage(int message_length)
@@ -437,7 +464,7 @@ QString qUtils::currencyLocale(qint64 amountSats)
     double btcRates = AppModel::instance()->btcRates()/100000000;
     double exRates = AppModel::instance()->exchangeRates();
     double balanceCurrency = btcRates*exRates*amountSats;
-    QLocale locale(QLocale::English);
+    static const QLocale locale(QLocale::English);
     QString output = locale.toString(balanceCurrency, 'f', 2);
 #if 0
     while (output.endsWith('0') && output.contains('.')) {
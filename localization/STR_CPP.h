@@ -3,134 +3,411 @@
 #include <QObject>
 #include <QString>
 
-const static QString STR_CPP_001 = QString("Please backup your wallet. You might also need to register it with your devices before you can spend money");
-const static QString STR_CPP_002 = QString("No name");
-const static QString STR_CPP_003 = QString("Could not finalize collaborative wallet");
-const static QString STR_CPP_004 = QString("Could not cancel collaborative wallet");
-const static QString STR_CPP_005 = QString("You get kicked out of the room by");
-const static QString STR_CPP_006 = QString("Could not join wallet");
-const static QString STR_CPP_007 = QString("Could not get unused XPUB, please top up");
-const static QString STR_CPP_008 = QString("Request to remove key from wallet");
-const static QString STR_CPP_009 = QString("Could not leave wallet");
-const static QString STR_CPP_010 = QString("Request cancel this wallet");
-const static QString STR_CPP_011 = QString("added key <b style=\"text-transform: uppercase;\">%1</b> to <b>%2</b>");
-const static QString STR_CPP_012 = QString("removed key <b style=\"text-transform: uppercase;\">%1</b> from <b>%2</b>");
-const static QString STR_CPP_013 = QString("The required number of keys has been assigned to <b>%1</b>");
-const static QString STR_CPP_014 = QString("<b>%1</b> has been created");
-const static QString STR_CPP_015 = QString("requested to cancel collaborative wallet <b>%1</b>");
-const static QString STR_CPP_016 = QString("signed the transaction with key <b style=\"text-transform: uppercase;\">%1</b>");
-const static QString STR_CPP_017 = QString("broadcast the transaction");
-const static QString STR_CPP_018 = QString("The transaction has enough signatures and is waiting to be broadcast");
-const static QString STR_CPP_019 = QString("canceled the transaction");
-const static QString STR_CPP_020 = QString("Received a new transaction");
-const static QString STR_CPP_021 = QString("reinvited %1 to the room");
-const static QString STR_CPP_022 = QString("joined the room (repeated)");
-const static QString STR_CPP_023 = QString("invited %1 to the room");
-const static QString STR_CPP_024 = QString("joined the room");
-const static QString STR_CPP_025 = QString("cleared their display name");
-const static QString STR_CPP_026 = QString("changed their display name to %1");
-const static QString STR_CPP_027 = QString(" and ");
-const static QString STR_CPP_028 = QString("cleared their avatar");
-const static QString STR_CPP_029 = QString("set an avatar");
-const static QString STR_CPP_030 = QString("updated their avatar");
-const static QString STR_CPP_031 = QString("withdrew %1's invitation");
-const static QString STR_CPP_032 = QString("rejected the invitation");
-const static QString STR_CPP_033 = QString("unbanned %1");
-const static QString STR_CPP_034 = QString("self-unbanned");
-const static QString STR_CPP_035 = QString("has put %1 out of the room: %2");
-const static QString STR_CPP_036 = QString("left the room");
-const static QString STR_CPP_037 = QString("banned %1 from the room: %2");
-const static QString STR_CPP_038 = QString("self-banned from the room");
-const static QString STR_CPP_039 = QString("knocked");
-const static QString STR_CPP_040 = QString("made something unknown");
-const static QString STR_CPP_041 = QString("has set room aliases on server %1 to: %2");
-const static QString STR_CPP_042 = QString("cleared the room main alias");
-const static QString STR_CPP_043 = QString("set the room main alias to: %1");
-const static QString STR_CPP_044 = QString("cleared the room name");
-const static QString STR_CPP_045 = QString("set the room name to: %1");
-const static QString STR_CPP_046 = QString("cleared the topic");
-const static QString STR_CPP_047 = QString("set the topic to: %1");
-const static QString STR_CPP_048 = QString("changed the room avatar");
-const static QString STR_CPP_049 = QString("activated End-to-End Encryption");
-const static QString STR_CPP_050 = QString("upgraded the room to version %1");
-const static QString STR_CPP_051 = QString("created the room, version %1");
-const static QString STR_CPP_052 = QString("upgraded the room: %1");
-const static QString STR_CPP_053 = QString("Unknown event");
-const static QString STR_CPP_054 = QString("Something went wrong when trying get your device.");
-const static QString STR_CPP_055 = QString("Device is NULL");
-const static QString STR_CPP_056 = QString("Could not scan devices");
-const static QString STR_CPP_057 = QString("The key has been added successfully!");
-const static QString STR_CPP_058 = QString("Could not create remote key");
-const static QString STR_CPP_059 = QString("Could not sign transaction");
-const static QString STR_CPP_060 = QString("Could not create master key");
-const static QString STR_CPP_061 = QString("Could not health check key");
-const static QString STR_CPP_062 = QString("The software key has been added successfully!");
-const static QString STR_CPP_063 = QString("Could not create software key");
-const static QString STR_CPP_064 = QString("Your wallet has been created.");
-const static QString STR_CPP_065 = QString("Could not create wallet");
-const static QString STR_CPP_066 = QString("Could not promt PIN on device");
-const static QString STR_CPP_067 = QString("The wallet has been imported successfully!");
-const static QString STR_CPP_068 = QString("Could not import wallet");
-const static QString STR_CPP_069 = QString("Could not get unused key from %1");
-const static QString STR_CPP_070 = QString("Could not get XPUBs for key %1");
-const static QString STR_CPP_071 = QString("Please top up XPUBs for your key");
-const static QString STR_CPP_072 = QString("For Escrow Wallet, you must spend all the out standing balance.");
-const static QString STR_CPP_073 = QString("Could not create transaction");
-const static QString STR_CPP_074 = QString("Could not init transaction");
-const static QString STR_CPP_075 = QString("Could not replace transaction");
-const static QString STR_CPP_076 = QString("Could not export transaction");
-const static QString STR_CPP_077 = QString("Cancel transaction");
-const static QString STR_CPP_078 = QString("Could not cancel transaction");
-const static QString STR_CPP_079 = QString("Could not unlock key");
-const static QString STR_CPP_080 = QString("Could not unlock the device");
-const static QString STR_CPP_081 = QString("Invalid seed phrase. Please try again.");
-const static QString STR_CPP_082 = QString("Could not recover key");
-const static QString STR_CPP_083 = QString("For Escrow Wallet, you must spend all the out standing balance.");
-const static QString STR_CPP_084 = QString("Could not export to QR Code");
-const static QString STR_CPP_085 = QString("The transaction has been broadcast successfully and pending confirmations.");
-const static QString STR_CPP_086 = QString("The transaction has been rejected by network rules.");
-const static QString STR_CPP_087 = QString("Could not broadcast transaction");
-const static QString STR_CPP_088 = QString("Could not import the transaction");
-const static QString STR_CPP_089 = QString("Could not change passphrase");
-const static QString STR_CPP_090 = QString("Change the passhrase for database successfully!");
-const static QString STR_CPP_091 = QString("PSBT imported successfully!");
-const static QString STR_CPP_092 = QString("Could not import the PSBT");
-const static QString STR_CPP_093 = QString("PSBT imported");
-const static QString STR_CPP_094 = QString("Your device is locked");
-const static QString STR_CPP_095 = QString("Your device is still locked, re-plug your device");
-const static QString STR_CPP_096 = QString("Your contact request has been sent");
-const static QString STR_CPP_097 = QString("XPUBs have been topped up successfully!");
-const static QString STR_CPP_098 = QString("Device not found, please connect and unlock your device before topping up XPUBs");
-const static QString STR_CPP_099 = QString("<b>*Encrypted*</b>");
-const static QString STR_CPP_100 = QString("Could not import the BSMS");
-const static QString STR_CPP_101 = QString("Imported successfully!");
-const static QString STR_CPP_102 = QString("[%1] has been added successfully! ");
-const static QString STR_CPP_103 = QString("We can’t find any account associated with this key.");
-const static QString STR_CPP_104 = QString("Account not found");
-const static QString STR_CPP_105 = QString("Account is exist");
-const static QString STR_CPP_106 = QString("Account has been created successfully");
-const static QString STR_CPP_107 = QString("Refresh limit exceeded. Please wait a few minutes");
-const static QString STR_CPP_108 = QString("Signed in with [<b>%1</b>]");
-const static QString STR_CPP_109 = QString("Your account has successfully been deleted");
-const static QString STR_CPP_110 = QString("TAPSIGNER has been recovered.");
-const static QString STR_CPP_111 = QString("No internet connection. Please try again later");
-const static QString STR_CPP_112 = QString("Error");
-const static QString STR_CPP_113 = QString("Invalid Backup Password");
-const static QString STR_CPP_114 = QString("Your account has been signed out");
-const static QString STR_CPP_115 = QString("Invalid password. Unable to restore backup.");
-const static QString STR_CPP_116 = QString("The Magic Phrase you entered does not match the one that you requested.");
-const static QString STR_CPP_117 = QString("Policies have been updated");
-const static QString STR_CPP_118 = QString("Could not claim inheritance");
-const static QString STR_CPP_119 = QString("The inheritance plan has been updated");
-const static QString STR_CPP_120 = QString("Invalid activation time");
-const static QString STR_CPP_121 = QString("Add Ledger to your assisted wallet");
-const static QString STR_CPP_122 = QString("Add Ledger");
-const static QString STR_CPP_123 = QString("Add Trezor to your assisted wallet");
-const static QString STR_CPP_124 = QString("Add Trezor");
-const static QString STR_CPP_125 = QString("Add COLDCARD to your assisted wallet");
-const static QString STR_CPP_126 = QString("Add COLDCARD");
-const static QString STR_CPP_127 = QString("Add BitBox to your assisted wallet");
-const static QString STR_CPP_128 = QString("Add BitBox");
-const static QString STR_CPP_129 = QString("Lost connection to device");
-const static QString STR_CPP_130 = QString("Wallet invitation has been denied");
+// All C++-side UI strings live in one catalog. Nothing here runs during static
+// initialization: the table is built on the first lookup and shared by every
+// translation unit, and STR_CPP_xxx keep working as const QString expressions.
+namespace StrCpp {
+enum Id : int {
+    ID_001,
+    ID_002,
+    ID_003,
+    ID_004,
+    ID_005,
+    ID_006,
+    ID_007,
+    ID_008,
+    ID_009,
+    ID_010,
+    ID_011,
+    ID_012,
+    ID_013,
+    ID_014,
+    ID_015,
+    ID_016,
+    ID_017,
+    ID_018,
+    ID_019,
+    ID_020,
+    ID_021,
+    ID_022,
+    ID_023,
+    ID_024,
+    ID_025,
+    ID_026,
+    ID_027,
+    ID_028,
+    ID_029,
+    ID_030,
+    ID_031,
+    ID_032,
+    ID_033,
+    ID_034,
+    ID_035,
+    ID_036,
+    ID_037,
+    ID_038,
+    ID_039,
+    ID_040,
+    ID_041,
+    ID_042,
+    ID_043,
+    ID_044,
+    ID_045,
+    ID_046,
+    ID_047,
+    ID_048,
+    ID_049,
+    ID_050,
+    ID_051,
+    ID_052,
+    ID_053,
+    ID_054,
+    ID_055,
+    ID_056,
+    ID_057,
+    ID_058,
+    ID_059,
+    ID_060,
+    ID_061,
+    ID_062,
+    ID_063,
+    ID_064,
+    ID_065,
+    ID_066,
+    ID_067,
+    ID_068,
+    ID_069,
+    ID_070,
+    ID_071,
+    ID_072,
+    ID_073,
+    ID_074,
+    ID_075,
+    ID_076,
+    ID_077,
+    ID_078,
+    ID_079,
+    ID_080,
+    ID_081,
+    ID_082,
+    ID_083,
+    ID_084,
+    ID_085,
+    ID_086,
+    ID_087,
+    ID_088,
+    ID_089,
+    ID_090,
+    ID_091,
+    ID_092,
+    ID_093,
+    ID_094,
+    ID_095,
+    ID_096,
+    ID_097,
+    ID_098,
+    ID_099,
+    ID_100,
+    ID_101,
+    ID_102,
+    ID_103,
+    ID_104,
+    ID_105,
+    ID_106,
+    ID_107,
+    ID_108,
+    ID_109,
+    ID_110,
+    ID_111,
+    ID_112,
+    ID_113,
+    ID_114,
+    ID_115,
+    ID_116,
+    ID_117,
+    ID_118,
+    ID_119,
+    ID_120,
+    ID_121,
+    ID_122,
+    ID_123,
+    ID_124,
+    ID_125,
+    ID_126,
+    ID_127,
+    ID_128,
+    ID_129,
+    ID_130,
+    ID_COUNT
+};
+
+inline const QString &text(Id id)
+{
+    static const QString table[ID_COUNT] = {
+        QString("Please backup your wallet. You might also need to register it with your devices before you can spend money"),
+        QString("No name"),
+        QString("Could not finalize collaborative wallet"),
+        QString("Could not cancel collaborative wallet"),
+        QString("You get kicked out of the room by"),
+        QString("Could not join wallet"),
+        QString("Could not get unused XPUB, please top up"),
+        QString("Request to remove key from wallet"),
+        QString("Could not leave wallet"),
+        QString("Request cancel this wallet"),
+        QString("added key <b style=\"text-transform: uppercase;\">%1</b> to <b>%2</b>"),
+        QString("removed key <b style=\"text-transform: uppercase;\">%1</b> from <b>%2</b>"),
+        QString("The required number of keys has been assigned to <b>%1</b>"),
+        QString("<b>%1</b> has been created"),
+        QString("requested to cancel collaborative wallet <b>%1</b>"),
+        QString("signed the transaction with key <b style=\"text-transform: uppercase;\">%1</b>"),
+        QString("broadcast the transaction"),
+        QString("The transaction has enough signatures and is waiting to be broadcast"),
+        QString("canceled the transaction"),
+        QString("Received a new transaction"),
+        QString("reinvited %1 to the room"),
+        QString("joined the room (repeated)"),
+        QString("invited %1 to the room"),
+        QString("joined the room"),
+        QString("cleared their display name"),
+        QString("changed their display name to %1"),
+        QString(" and "),
+        QString("cleared their avatar"),
+        QString("set an avatar"),
+        QString("updated their avatar"),
+        QString("withdrew %1's invitation"),
+        QString("rejected the invitation"),
+        QString("unbanned %1"),
+        QString("self-unbanned"),
+        QString("has put %1 out of the room: %2"),
+        QString("left the room"),
+        QString("banned %1 from the room: %2"),
+        QString("self-banned from the room"),
+        QString("knocked"),
+        QString("made something unknown"),
+        QString("has set room aliases on server %1 to: %2"),
+        QString("cleared the room main alias"),
+        QString("set the room main alias to: %1"),
+        QString("cleared the room name"),
+        QString("set the room name to: %1"),
+        QString("cleared the topic"),
+        QString("set the topic to: %1"),
+        QString("changed the room avatar"),
+        QString("activated End-to-End Encryption"),
+        QString("upgraded the room to version %1"),
+        QString("created the room, version %1"),
+        QString("upgraded the room: %1"),
+        QString("Unknown event"),
+        QString("Something went wrong when trying get your device."),
+        QString("Device is NULL"),
+        QString("Could not scan devices"),
+        QString("The key has been added successfully!"),
+        QString("Could not create remote key"),
+        QString("Could not sign transaction"),
+        QString("Could not create master key"),
+        QString("Could not health check key"),
+        QString("The software key has been added successfully!"),
+        QString("Could not create software key"),
+        QString("Your wallet has been created."),
+        QString("Could not create wallet"),
+        QString("Could not promt PIN on device"),
+        QString("The wallet has been imported successfully!"),
+        QString("Could not import wallet"),
+        QString("Could not get unused key from %1"),
+        QString("Could not get XPUBs for key %1"),
+        QString("Please top up XPUBs for your key"),
+        QString("For Escrow Wallet, you must spend all the out standing balance."),
+        QString("Could not create transaction"),
+        QString("Could not init transaction"),
+        QString("Could not replace transaction"),
+        QString("Could not export transaction"),
+        QString("Cancel transaction"),
+        QString("Could not cancel transaction"),
+        QString("Could not unlock key"),
+        QString("Could not unlock the device"),
+        QString("Invalid seed phrase. Please try again."),
+        QString("Could not recover key"),
+        QString("For Escrow Wallet, you must spend all the out standing balance."),
+        QString("Could not export to QR Code"),
+        QString("The transaction has been broadcast successfully and pending confirmations."),
+        QString("The transaction has been rejected by network rules."),
+        QString("Could not broadcast transaction"),
+        QString("Could not import the transaction"),
+        QString("Could not change passphrase"),
+        QString("Change the passhrase for database successfully!"),
+        QString("PSBT imported successfully!"),
+        QString("Could not import the PSBT"),
+        QString("PSBT imported"),
+        QString("Your device is locked"),
+        QString("Your device is still locked, re-plug your device"),
+        QString("Your contact request has been sent"),
+        QString("XPUBs have been topped up successfully!"),
+        QString("Device not found, please connect and unlock your device before topping up XPUBs"),
+        QString("<b>*Encrypted*</b>"),
+        QString("Could not import the BSMS"),
+        QString("Imported successfully!"),
+        QString("[%1] has been added successfully! "),
+        QString("We can’t find any account associated with this key."),
+        QString("Account not found"),
+        QString("Account is exist"),
+        QString("Account has been created successfully"),
+        QString("Refresh limit exceeded. Please wait a few minutes"),
+        QString("Signed in with [<b>%1</b>]"),
+        QString("Your account has successfully been deleted"),
+        QString("TAPSIGNER has been recovered."),
+        QString("No internet connection. Please try again later"),
+        QString("Error"),
+        QString("Invalid Backup Password"),
+        QString("Your account has been signed out"),
+        QString("Invalid password. Unable to restore backup."),
+        QString("The Magic Phrase you entered does not match the one that you requested."),
+        QString("Policies have been updated"),
+        QString("Could not claim inheritance"),
+        QString("The inheritance plan has been updated"),
+        QString("Invalid activation time"),
+        QString("Add Ledger to your assisted wallet"),
+        QString("Add Ledger"),
+        QString("Add Trezor to your assisted wallet"),
+        QString("Add Trezor"),
+        QString("Add COLDCARD to your assisted wallet"),
+        QString("Add COLDCARD"),
+        QString("Add BitBox to your assisted wallet"),
+        QString("Add BitBox"),
+        QString("Lost connection to device"),
+        QString("Wallet invitation has been denied"),
+    };
+    return table[id];
+}
+}
+
+#define STR_CPP_001 StrCpp::text(StrCpp::ID_001)
+#define STR_CPP_002 StrCpp::text(StrCpp::ID_002)
+#define STR_CPP_003 StrCpp::text(StrCpp::ID_003)
+#define STR_CPP_004 StrCpp::text(StrCpp::ID_004)
+#define STR_CPP_005 StrCpp::text(StrCpp::ID_005)
+#define STR_CPP_006 StrCpp::text(StrCpp::ID_006)
+#define STR_CPP_007 StrCpp::text(StrCpp::ID_007)
+#define STR_CPP_008 StrCpp::text(StrCpp::ID_008)
+#define STR_CPP_009 StrCpp::text(StrCpp::ID_009)
+#define STR_CPP_010 StrCpp::text(StrCpp::ID_010)
+#define STR_CPP_011 StrCpp::text(StrCpp::ID_011)
+#define STR_CPP_012 StrCpp::text(StrCpp::ID_012)
+#define STR_CPP_013 StrCpp::text(StrCpp::ID_013)
+#define STR_CPP_014 StrCpp::text(StrCpp::ID_014)
+#define STR_CPP_015 StrCpp::text(StrCpp::ID_015)
+#define STR_CPP_016 StrCpp::text(StrCpp::ID_016)
+#define STR_CPP_017 StrCpp::text(StrCpp::ID_017)
+#define STR_CPP_018 StrCpp::text(StrCpp::ID_018)
+#define STR_CPP_019 StrCpp::text(StrCpp::ID_019)
+#define STR_CPP_020 StrCpp::text(StrCpp::ID_020)
+#define STR_CPP_021 StrCpp::text(StrCpp::ID_021)
+#define STR_CPP_022 StrCpp::text(StrCpp::ID_022)
+#define STR_CPP_023 StrCpp::text(StrCpp::ID_023)
+#define STR_CPP_024 StrCpp::text(StrCpp::ID_024)
+#define STR_CPP_025 StrCpp::text(StrCpp::ID_025)
+#define STR_CPP_026 StrCpp::text(StrCpp::ID_026)
+#define STR_CPP_027 StrCpp::text(StrCpp::ID_027)
+#define STR_CPP_028 StrCpp::text(StrCpp::ID_028)
+#define STR_CPP_029 StrCpp::text(StrCpp::ID_029)
+#define STR_CPP_030 StrCpp::text(StrCpp::ID_030)
+#define STR_CPP_031 StrCpp::text(StrCpp::ID_031)
+#define STR_CPP_032 StrCpp::text(StrCpp::ID_032)
+#define STR_CPP_033 StrCpp::text(StrCpp::ID_033)
+#define STR_CPP_034 StrCpp::text(StrCpp::ID_034)
+#define STR_CPP_035 StrCpp::text(StrCpp::ID_035)
+#define STR_CPP_036 StrCpp::text(StrCpp::ID_036)
+#define STR_CPP_037 StrCpp::text(StrCpp::ID_037)
+#define STR_CPP_038 StrCpp::text(StrCpp::ID_038)
+#define STR_CPP_039 StrCpp::text(StrCpp::ID_039)
+#define STR_CPP_040 StrCpp::text(StrCpp::ID_040)
+#define STR_CPP_041 StrCpp::text(StrCpp::ID_041)
+#define STR_CPP_042 StrCpp::text(StrCpp::ID_042)
+#define STR_CPP_043 StrCpp::text(StrCpp::ID_043)
+#define STR_CPP_044 StrCpp::text(StrCpp::ID_044)
+#define STR_CPP_045 StrCpp::text(StrCpp::ID_045)
+#define STR_CPP_046 StrCpp::text(StrCpp::ID_046)
+#define STR_CPP_047 StrCpp::text(StrCpp::ID_047)
+#define STR_CPP_048 StrCpp::text(StrCpp::ID_048)
+#define STR_CPP_049 StrCpp::text(StrCpp::ID_049)
+#define STR_CPP_050 StrCpp::text(StrCpp::ID_050)
+#define STR_CPP_051 StrCpp::text(StrCpp::ID_051)
+#define STR_CPP_052 StrCpp::text(StrCpp::ID_052)
+#define STR_CPP_053 StrCpp::text(StrCpp::ID_053)
+#define STR_CPP_054 StrCpp::text(StrCpp::ID_054)
+#define STR_CPP_055 StrCpp::text(StrCpp::ID_055)
+#define STR_CPP_056 StrCpp::text(StrCpp::ID_056)
+#define STR_CPP_057 StrCpp::text(StrCpp::ID_057)
+#define STR_CPP_058 StrCpp::text(StrCpp::ID_058)
+#define STR_CPP_059 StrCpp::text(StrCpp::ID_059)
+#define STR_CPP_060 StrCpp::text(StrCpp::ID_060)
+#define STR_CPP_061 StrCpp::text(StrCpp::ID_061)
+#define STR_CPP_062 StrCpp::text(StrCpp::ID_062)
+#define STR_CPP_063 StrCpp::text(StrCpp::ID_063)
+#define STR_CPP_064 StrCpp::text(StrCpp::ID_064)
+#define STR_CPP_065 StrCpp::text(StrCpp::ID_065)
+#define STR_CPP_066 StrCpp::text(StrCpp::ID_066)
+#define STR_CPP_067 StrCpp::text(StrCpp::ID_067)
+#define STR_CPP_068 StrCpp::text(StrCpp::ID_068)
+#define STR_CPP_069 StrCpp::text(StrCpp::ID_069)
+#define STR_CPP_070 StrCpp::text(StrCpp::ID_070)
+#define STR_CPP_071 StrCpp::text(StrCpp::ID_071)
+#define STR_CPP_072 StrCpp::text(StrCpp::ID_072)
+#define STR_CPP_073 StrCpp::text(StrCpp::ID_073)
+#define STR_CPP_074 StrCpp::text(StrCpp::ID_074)
+#define STR_CPP_075 StrCpp::text(StrCpp::ID_075)
+#define STR_CPP_076 StrCpp::text(StrCpp::ID_076)
+#define STR_CPP_077 StrCpp::text(StrCpp::ID_077)
+#define STR_CPP_078 StrCpp::text(StrCpp::ID_078)
+#define STR_CPP_079 StrCpp::text(StrCpp::ID_079)
+#define STR_CPP_080 StrCpp::text(StrCpp::ID_080)
+#define STR_CPP_081 StrCpp::text(StrCpp::ID_081)
+#define STR_CPP_082 StrCpp::text(StrCpp::ID_082)
+#define STR_CPP_083 StrCpp::text(StrCpp::ID_083)
+#define STR_CPP_084 StrCpp::text(StrCpp::ID_084)
+#define STR_CPP_085 StrCpp::text(StrCpp::ID_085)
+#define STR_CPP_086 StrCpp::text(StrCpp::ID_086)
+#define STR_CPP_087 StrCpp::text(StrCpp::ID_087)
+#define STR_CPP_088 StrCpp::text(StrCpp::ID_088)
+#define STR_CPP_089 StrCpp::text(StrCpp::ID_089)
+#define STR_CPP_090 StrCpp::text(StrCpp::ID_090)
+#define STR_CPP_091 StrCpp::text(StrCpp::ID_091)
+#define STR_CPP_092 StrCpp::text(StrCpp::ID_092)
+#define STR_CPP_093 StrCpp::text(StrCpp::ID_093)
+#define STR_CPP_094 StrCpp::text(StrCpp::ID_094)
+#define STR_CPP_095 StrCpp::text(StrCpp::ID_095)
+#define STR_CPP_096 StrCpp::text(StrCpp::ID_096)
+#define STR_CPP_097 StrCpp::text(StrCpp::ID_097)
+#define STR_CPP_098 StrCpp::text(StrCpp::ID_098)
+#define STR_CPP_099 StrCpp::text(StrCpp::ID_099)
+#define STR_CPP_100 StrCpp::text(StrCpp::ID_100)
+#define STR_CPP_101 StrCpp::text(StrCpp::ID_101)
+#define STR_CPP_102 StrCpp::text(StrCpp::ID_102)
+#define STR_CPP_103 StrCpp::text(StrCpp::ID_103)
+#define STR_CPP_104 StrCpp::text(StrCpp::ID_104)
+#define STR_CPP_105 StrCpp::text(StrCpp::ID_105)
+#define STR_CPP_106 StrCpp::text(StrCpp::ID_106)
+#define STR_CPP_107 StrCpp::text(StrCpp::ID_107)
+#define STR_CPP_108 StrCpp::text(StrCpp::ID_108)
+#define STR_CPP_109 StrCpp::text(StrCpp::ID_109)
+#define STR_CPP_110 StrCpp::text(StrCpp::ID_110)
+#define STR_CPP_111 StrCpp::text(StrCpp::ID_111)
+#define STR_CPP_112 StrCpp::text(StrCpp::ID_112)
+#define STR_CPP_113 StrCpp::text(StrCpp::ID_113)
+#define STR_CPP_114 StrCpp::text(StrCpp::ID_114)
+#define STR_CPP_115 StrCpp::text(StrCpp::ID_115)
+#define STR_CPP_116 StrCpp::text(StrCpp::ID_116)
+#define STR_CPP_117 StrCpp::text(StrCpp::ID_117)
+#define STR_CPP_118 StrCpp::text(StrCpp::ID_118)
+#define STR_CPP_119 StrCpp::text(StrCpp::ID_119)
+#define STR_CPP_120 StrCpp::text(StrCpp::ID_120)
+#define STR_CPP_121 StrCpp::text(StrCpp::ID_121)
+#define STR_CPP_122 StrCpp::text(StrCpp::ID_122)
+#define STR_CPP_123 StrCpp::text(StrCpp::ID_123)
+#define STR_CPP_124 StrCpp::text(StrCpp::ID_124)
+#define STR_CPP_125 StrCpp::text(StrCpp::ID_125)
+#define STR_CPP_126 StrCpp::text(StrCpp::ID_126)
+#define STR_CPP_127 StrCpp::text(StrCpp::ID_127)
+#define STR_CPP_128 StrCpp::text(StrCpp::ID_128)
+#define STR_CPP_129 StrCpp::text(StrCpp::ID_129)
+#define STR_CPP_130 StrCpp::text(StrCpp::ID_130)
+
 #endif // STR_CPP_H
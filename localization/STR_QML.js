@@ -1744,3 +1744,7 @@ var STR_QML_1617 = qsTr("TAPSIGNER")
 var STR_QML_1618 = qsTr("COLDCARD")
 var STR_QML_1619 = qsTr("The Backup Password can be found on the back of the TAPSIGNER designated for inheritance. (It might be listed under “Backup key”).")
 var STR_QML_1620 = qsTr("The Backup Password (12 words) that was displayed on the COLDCARD device when you created the backup file.")
+var STR_QML_1621 = qsTr("Exporting transactions ...")
+var STR_QML_1622 = qsTr("%1 transactions written")
+var STR_QML_1623 = qsTr("Transactions exported")
+var STR_QML_1624 = qsTr("Transaction export failed: %1")
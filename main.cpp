@@ -40,6 +40,7 @@
 #include "QPingThread.h"
 #include "QRScanner/QBarcodeFilter.h"
 #include "QPDFPrinter.h"
+#include "Commons/TransactionExport.h"
 
 QStringList latoFonts = {
     ":/fonts/fonts/Lato/Lato-BlackItalic.ttf",
@@ -204,6 +205,7 @@ int main(int argc, char* argv[])
     QEventProcessor::instance()->registerCtxProperty("ServiceSetting", QVariant::fromValue(ServiceSetting::instance()));
     QEventProcessor::instance()->registerCtxProperty("OnBoarding", QVariant::fromValue(OnBoardingModel::instance()));
     QEventProcessor::instance()->registerCtxProperty("PDFPrinter", QVariant::fromValue(QPDFPrinter::instance()));
+    QEventProcessor::instance()->registerCtxProperty("TransactionExport", QVariant::fromValue(TransactionExport::instance()));
     QEventProcessor::instance()->completed();
     QEventProcessor::instance()->sendEvent(E::EVT_STARTING_APPLICATION_ONLINEMODE);
     //    QEventProcessor::instance()->sendEvent(E::EVT_STARTING_APPLICATION_LOCALMODE);